@@ -63,6 +63,9 @@ public class BiomeMapper : ModuleRules
             PrivateDependencyModuleNames.Add("EditorScriptingUtilities");
         }
 
+        // Private/*.ispc are compiled by UBT when the target has bCompileISPC, for each instruction set
+        // of the platform, and INTEL_ISPC is set; elsewhere the C++ fallbacks are used (see BiomeISPC.h)
+
         // Enable IWYU for better header management
         bEnforceIWYU = true;
 
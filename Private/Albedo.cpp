@@ -1,5 +1,4 @@
 #include "Albedo.h"
-#include "HeightmapCell.h"
 #include "Async/ParallelFor.h"
 #include <algorithm>
 
@@ -23,33 +22,37 @@ float Albedo::AdjustAlbedoForPrecipitation(float Albedo, float Precipitation) {
     return Albedo;
 }
 
-// Compute dynamic Albedo based on environmental factors
-void Albedo::CalculateDynamicAlbedo(TArray<FHeightmapCell>& HeightmapData)
+// Compute dynamic Albedo of one cell
+float Albedo::CalculateCellAlbedo(float CurrentAlbedo, float BaseAlbedo, float DistanceToOcean, float Temperature, float Precipitation)
 {
-     // Precompute OceanToLandVectors
-    ParallelFor(HeightmapData.Num(), [&](int32 i)
+    float CellAlbedo = CurrentAlbedo;
+
+    if (DistanceToOcean > 0.0f)
     {
-        FHeightmapCell& Cell = HeightmapData[i];
-        
-        if (Cell.DistanceToOcean > 0.0f)
+        // Step 1: Base Albedo based on Latitude, see CalculateAlbedo
+        CellAlbedo = BaseAlbedo;
+
+        // Step 2: Adjust Albedo for Snow and Temperature below freezing
+        if(Temperature < 0.0f)
+        {
+            CellAlbedo = AdjustAlbedoForSnow(CellAlbedo, Temperature);
+        }
+        else
         {
-            // Step 1: Calculate base Albedo based on Latitude.
-            Cell.Albedo = CalculateAlbedo(Cell.Latitude);
-
-            // Step 2: Adjust Albedo for Snow and Temperature below freezing
-            if(Cell.Temperature < 0.0f)
-            {
-                Cell.Albedo = AdjustAlbedoForSnow(Cell.Albedo, Cell.Temperature);
-            }
-            else
-            {
-                // Step 3: Adjust Albedo for Vegetation, ie Annual Rainfall
-                Cell.Albedo = AdjustAlbedoForPrecipitation(Cell.Albedo, Cell.AnnualPrecipitation);
-            }
+            // Step 3: Adjust Albedo for Vegetation, ie Annual Rainfall
+            CellAlbedo = AdjustAlbedoForPrecipitation(CellAlbedo, Precipitation);
         }
+    }
 
-        // Ensure that the Albedo stays within realistic bounds
-        Cell.Albedo = FMath::Clamp(Cell.Albedo, 0.05f, 0.80f);
-    });   
-   
+    // Ensure that the Albedo stays within realistic bounds
+    return FMath::Clamp(CellAlbedo, 0.05f, 0.80f);
+}
+
+// Compute dynamic Albedo based on environmental factors
+void Albedo::CalculateDynamicAlbedo(FClimateGrid& Grid)
+{
+    ParallelFor(Grid.Num(), [&](int32 i)
+    {
+        Grid.Albedo[i] = CalculateCellAlbedo(Grid.Albedo[i], CalculateAlbedo(Grid.GetLatitude(i)), Grid.DistanceToOcean[i], Grid.Temperature[i], Grid.AnnualPrecipitation[i]);
+    });
 }
\ No newline at end of file
@@ -1,8 +1,19 @@
 #include "Altitude.h"
 
-float CalculateAltitude(uint8 PixelValue, float MinAltitude, float MaxAltitude)
+float CalculateAltitude(float NormalizedValue, float MinAltitude, float MaxAltitude)
 {
-    return MinAltitude + (PixelValue / 255.0f) * (MaxAltitude - MinAltitude);
+    return MinAltitude + FMath::Clamp(NormalizedValue, 0.0f, 1.0f) * (MaxAltitude - MinAltitude);
+}
+
+void CalculateAltitudes(const float* NormalizedSamples, int32 NumSamples, float MinAltitude, float MaxAltitude, float* OutAltitudes)
+{
+    const float AltitudeRange = MaxAltitude - MinAltitude;
+
+    // Min/max rather than a branchy clamp keeps the loop a straight multiply-add over the run
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        OutAltitudes[Index] = MinAltitude + FMath::Min(FMath::Max(NormalizedSamples[Index], 0.0f), 1.0f) * AltitudeRange;
+    }
 }
 
 float CalculateOceanDepth(float SeaLevel, float RawAltitude)
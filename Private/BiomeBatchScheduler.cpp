@@ -0,0 +1,383 @@
+#include "BiomeBatchScheduler.h"
+#include "BiomeCalculator.h"
+#include "BiomeDataExporter.h"
+#include "BiomeStatistics.h"
+#include "ClimateGrid.h"
+#include "HeightmapParser.h"
+#include "TiledBiomePipeline.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    bool IsHeightmapFile(const FString& FilePath)
+    {
+        const FString Extension = FPaths::GetExtension(FilePath).ToLower();
+        return Extension == TEXT("r16") || Extension == TEXT("r32") || Extension == TEXT("raw") ||
+               Extension == TEXT("png") || Extension == TEXT("jpg") || Extension == TEXT("jpeg");
+    }
+
+    /** Adds a job writing into its own directory under OutputRoot, even if two heightmaps share a name. */
+    void AddJob(const FString& HeightmapPath, const FBiomeSimulationContext& Context, const FString& OutputRoot,
+                TSet<FString>& UsedNames, TArray<FBiomeBatchJob>& OutJobs)
+    {
+        FString Name = FPaths::GetBaseFilename(HeightmapPath);
+        for (int32 Suffix = 2; UsedNames.Contains(Name); ++Suffix)
+        {
+            Name = FString::Printf(TEXT("%s_%d"), *FPaths::GetBaseFilename(HeightmapPath), Suffix);
+        }
+        UsedNames.Add(Name);
+
+        FBiomeBatchJob& Job = OutJobs.AddDefaulted_GetRef();
+        Job.HeightmapPath = HeightmapPath;
+        Job.OutputDirectory = FPaths::Combine(OutputRoot, Name);
+        Job.Context = Context;
+    }
+
+    /** Checks the inputs of a manifest line; returns an empty string if they are usable, otherwise the reason. */
+    FString ValidateManifestContext(const FInputParameters& InputParams, float YearLength, float DayLength, float DayOfYear)
+    {
+        if (InputParams.NorthernLatitude < -90.0f || InputParams.NorthernLatitude > 90.0f ||
+            InputParams.SouthernLatitude < -90.0f || InputParams.SouthernLatitude > 90.0f)
+        {
+            return TEXT("latitudes must be within [-90, 90]");
+        }
+        if (InputParams.SouthernLatitude >= InputParams.NorthernLatitude)
+        {
+            return TEXT("the southern latitude must be below the northern latitude");
+        }
+        if (InputParams.CentralLongitude < -180.0f || InputParams.CentralLongitude > 180.0f)
+        {
+            return TEXT("the central longitude must be within [-180, 180]");
+        }
+        if (InputParams.MinimumAltitude >= InputParams.MaximumAltitude)
+        {
+            return TEXT("the minimum altitude must be below the maximum altitude");
+        }
+        if (YearLength <= 0.0f || DayLength <= 0.0f)
+        {
+            return TEXT("the year and day lengths must be positive");
+        }
+        if (DayOfYear < 0.0f || DayOfYear > YearLength)
+        {
+            return TEXT("the day of the year must be within [0, YearLength]");
+        }
+        return FString();
+    }
+
+    /** Climate stages, classification and output of one loaded heightmap. Runs on a pool thread. */
+    bool ProcessJob(FBiomeBatchJob& Job, const TArray<float>& Samples, int32 Width, int32 Height,
+                    UBiomeCalculator& Calculator, const FBiomeDataExportSettings& ExportSettings)
+    {
+        FClimateGrid Grid;
+        float MinLongitude = 0.0f;
+        float MaxLongitude = 0.0f;
+        FVector2D Resolution;
+
+        if (!UHeightmapParser::ProcessHeightmapSamples(Samples, Width, Height, Job.Context, MinLongitude, MaxLongitude, Grid, Resolution))
+        {
+            return false;
+        }
+
+        const FInputParameters& InputParams = Job.Context.InputParams;
+        if (InputParams.SouthernLatitude > InputParams.NorthernLatitude || MinLongitude > MaxLongitude || InputParams.MinimumAltitude > InputParams.MaximumAltitude)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Invalid input ranges provided for %s."), *Job.HeightmapPath);
+            return false;
+        }
+
+        // Classify like CalculateBiomeFromInput, but keep the statistics and write into the job's directory
+        Calculator.PrepareLookupTable(InputParams);
+
+        FBiomeStatistics Statistics;
+        Calculator.ClassifyGrid(Job.Context, MinLongitude, MaxLongitude, Grid, FIntRect(0, 0, Width, Height), Statistics);
+
+        const FString& Directory = Job.OutputDirectory;
+        if (!FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*Directory))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create output directory: %s"), *Directory);
+            return false;
+        }
+
+        // Same planes as the tiled pipeline, plus the climate fields only an in-core run keeps
+        Job.Summary = UBiomeCalculator::FormatBiomeSummary(Statistics);
+        const bool bWritten =
+            FTiledBiomePipeline::WriteBiomePalette(Directory) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("BiomeId.r8"), Grid.BiomeId.GetData(), Width, Height, 8) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("Altitude.r32"), Grid.Altitude.GetData(), Width, Height, 32) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("Temperature.r32"), Grid.Temperature.GetData(), Width, Height, 32) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("Precipitation.r32"), Grid.AnnualPrecipitation.GetData(), Width, Height, 32) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("Slope.r32"), Grid.Slope.GetData(), Width, Height, 32) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("Aspect.r32"), Grid.Aspect.GetData(), Width, Height, 32) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("Curvature.r32"), Grid.Curvature.GetData(), Width, Height, 32) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("Roughness.r32"), Grid.Roughness.GetData(), Width, Height, 32) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("DistanceToOcean.r32"), Grid.DistanceToOcean.GetData(), Width, Height, 32) &&
+            FTiledBiomePipeline::WritePlane(Directory, TEXT("Albedo.r32"), Grid.Albedo.GetData(), Width, Height, 32) &&
+            FFileHelper::SaveStringToFile(Statistics.FormatLatitudeBandsCSV(), *FPaths::Combine(Directory, TEXT("BiomeLatitudeBands.csv"))) &&
+            FFileHelper::SaveStringToFile(Job.Summary, *FPaths::Combine(Directory, TEXT("BiomeSummary.txt")));
+
+        if (!bWritten)
+        {
+            return false;
+        }
+
+        return !ExportSettings.bEnabled || FBiomeDataExporter::Export(Grid, ExportSettings, Directory);
+    }
+}
+
+bool FBiomeBatchScheduler::CollectJobs(
+    const FString& DirectoryOrManifest,
+    const FBiomeSimulationContext& DefaultContext,
+    const FString& OutputRoot,
+    TArray<FBiomeBatchJob>& OutJobs)
+{
+    TSet<FString> UsedNames;
+
+    if (FPaths::DirectoryExists(DirectoryOrManifest))
+    {
+        TArray<FString> FileNames;
+        IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(DirectoryOrManifest, TEXT("*")), true, false);
+        FileNames.Sort();
+
+        for (const FString& FileName : FileNames)
+        {
+            if (IsHeightmapFile(FileName))
+            {
+                AddJob(FPaths::Combine(DirectoryOrManifest, FileName), DefaultContext, OutputRoot, UsedNames, OutJobs);
+            }
+        }
+    }
+    else
+    {
+        TArray<FString> Lines;
+        if (!FFileHelper::LoadFileToStringArray(Lines, *DirectoryOrManifest))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to read batch manifest: %s"), *DirectoryOrManifest);
+            return false;
+        }
+
+        const FString ManifestDirectory = FPaths::GetPath(DirectoryOrManifest);
+        for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+        {
+            const FString Line = Lines[LineIndex].TrimStartAndEnd();
+            if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+            {
+                continue;
+            }
+
+            TArray<FString> Fields;
+            Line.ParseIntoArray(Fields, TEXT(","), false);
+
+            FString HeightmapPath = Fields[0].TrimStartAndEnd();
+            if (FPaths::IsRelative(HeightmapPath))
+            {
+                HeightmapPath = FPaths::Combine(ManifestDirectory, HeightmapPath);
+            }
+
+            // Optional per-map overrides, in manifest column order
+            FBiomeSimulationContext Context = DefaultContext;
+            FInputParameters& InputParams = Context.InputParams;
+            float YearLength = Context.PlanetTime.GetYearLength();
+            float DayLength = Context.PlanetTime.GetDayLengthHours();
+            float DayOfYear = Context.PlanetTime.GetDayOfYear();
+            float* const Overrides[] = {
+                &InputParams.NorthernLatitude, &InputParams.SouthernLatitude, &InputParams.CentralLongitude,
+                &InputParams.MinimumAltitude, &InputParams.MaximumAltitude, &InputParams.SeaLevel,
+                &YearLength, &DayLength, &DayOfYear };
+            const TCHAR* const OverrideNames[] = {
+                TEXT("NorthLat"), TEXT("SouthLat"), TEXT("CentralLon"), TEXT("MinAlt"), TEXT("MaxAlt"), TEXT("SeaLevel"),
+                TEXT("YearLength"), TEXT("DayLength"), TEXT("DayOfYear") };
+            static_assert(UE_ARRAY_COUNT(Overrides) == UE_ARRAY_COUNT(OverrideNames), "Every override needs a name");
+
+            const int32 NumOverrides = UE_ARRAY_COUNT(Overrides);
+            FString Error;
+            if (Fields.Num() > NumOverrides + 1)
+            {
+                Error = FString::Printf(TEXT("expected at most %d values after the path"), NumOverrides);
+            }
+
+            for (int32 Column = 1; Error.IsEmpty() && Column < Fields.Num(); ++Column)
+            {
+                const FString Value = Fields[Column].TrimStartAndEnd();
+                if (Value.IsEmpty())
+                {
+                    continue;
+                }
+                if (!Value.IsNumeric())
+                {
+                    Error = FString::Printf(TEXT("%s is not a number: '%s'"), OverrideNames[Column - 1], *Value);
+                    break;
+                }
+                *Overrides[Column - 1] = FCString::Atof(*Value);
+            }
+
+            if (Error.IsEmpty())
+            {
+                Error = ValidateManifestContext(InputParams, YearLength, DayLength, DayOfYear);
+            }
+
+            if (Error.IsEmpty())
+            {
+                Context.PlanetTime = FPlanetTime(YearLength, DayLength, Context.PlanetTime.GetDayLengthMinutes(),
+                                                 FMath::RoundToInt(DayOfYear), Context.PlanetTime.GetTimeOfDay());
+            }
+
+            AddJob(HeightmapPath, Context, OutputRoot, UsedNames, OutJobs);
+
+            // A bad line fails its own job; the rest of the batch still runs
+            if (!Error.IsEmpty())
+            {
+                UE_LOG(LogTemp, Error, TEXT("Batch manifest %s, line %d: %s"), *DirectoryOrManifest, LineIndex + 1, *Error);
+                OutJobs.Last().bRejected = true;
+            }
+        }
+    }
+
+    if (OutJobs.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("No heightmaps found in %s"), *DirectoryOrManifest);
+        return false;
+    }
+
+    return true;
+}
+
+int64 FBiomeBatchScheduler::EstimateJobBytes(int32 Width, int32 Height)
+{
+    // Same per-cell accounting as a tile, which already includes the sample plane
+    return static_cast<int64>(Width) * Height * FTiledBiomePipeline::GetEstimatedBytesPerCell();
+}
+
+bool FBiomeBatchScheduler::Run(TArray<FBiomeBatchJob>& Jobs, const FBiomeBatchSettings& Settings)
+{
+    check(IsInGameThread());
+
+    const int32 MaxConcurrentJobs = FMath::Max(Settings.MaxConcurrentJobs, 1);
+
+    // Admission state, shared with the running jobs
+    FCriticalSection AdmissionLock;
+    int32 NumRunning = 0;
+    int64 RunningBytes = 0;
+    int32 NumFinished = 0;
+    FEvent* JobFinished = FPlatformProcess::GetSynchEventFromPool(false);
+
+    // Each running job needs its own calculator, since PrepareLookupTable depends on the job's inputs
+    TArray<UBiomeCalculator*> AllCalculators;
+    TArray<UBiomeCalculator*> IdleCalculators;
+
+    TArray<TFuture<void>> Tasks;
+    Tasks.Reserve(Jobs.Num());
+
+    for (FBiomeBatchJob& Job : Jobs)
+    {
+        if (Job.bRejected)
+        {
+            Job.bSucceeded = false;
+            continue;
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+
+        // Dimensions only, so the job is admitted before its samples take up memory
+        int32 Width = 0;
+        int32 Height = 0;
+        if (!UHeightmapParser::ReadHeightmapDimensions(Job.HeightmapPath, Width, Height))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to read heightmap dimensions: %s"), *Job.HeightmapPath);
+            Job.bSucceeded = false;
+            continue;
+        }
+
+        // Wait for a free slot within the budget; a job over budget waits until it can run alone
+        const int64 JobBytes = EstimateJobBytes(Width, Height);
+        UBiomeCalculator* Calculator = nullptr;
+        for (;;)
+        {
+            {
+                FScopeLock Lock(&AdmissionLock);
+                if (NumRunning == 0 || (NumRunning < MaxConcurrentJobs && RunningBytes + JobBytes <= Settings.MemoryBudgetBytes))
+                {
+                    ++NumRunning;
+                    RunningBytes += JobBytes;
+                    Calculator = IdleCalculators.Num() > 0 ? IdleCalculators.Pop() : nullptr;
+                    break;
+                }
+            }
+            JobFinished->Wait();
+        }
+
+        // Load on this thread while earlier jobs run their climate stages; the samples are already counted in JobBytes
+        const TSharedRef<TArray<float>, ESPMode::ThreadSafe> Samples = MakeShared<TArray<float>, ESPMode::ThreadSafe>();
+        int32 LoadedWidth = 0;
+        int32 LoadedHeight = 0;
+        int32 BitDepth = 0;
+        const bool bLoaded = UHeightmapParser::LoadHeightmap(Job.HeightmapPath, *Samples, LoadedWidth, LoadedHeight, BitDepth);
+
+        if (!bLoaded || LoadedWidth != Width || LoadedHeight != Height)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to load heightmap: %s"), *Job.HeightmapPath);
+            Job.bSucceeded = false;
+
+            FScopeLock Lock(&AdmissionLock);
+            --NumRunning;
+            RunningBytes -= JobBytes;
+            if (Calculator)
+            {
+                IdleCalculators.Push(Calculator);
+            }
+            continue;
+        }
+
+        // Objects are created on the game thread and rooted while a pool thread uses them
+        if (!Calculator)
+        {
+            Calculator = NewObject<UBiomeCalculator>();
+            Calculator->LookupTableSettings = Settings.LookupTable;
+            Calculator->AddToRoot();
+            AllCalculators.Add(Calculator);
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("Batch: starting %s (%dx%d, ~%lld MB)"), *Job.HeightmapPath, Width, Height, JobBytes / (1024 * 1024));
+
+        Tasks.Add(Async(EAsyncExecution::ThreadPool, [&, Samples, Width, Height, JobBytes, Calculator, StartTime, JobPtr = &Job]()
+        {
+            JobPtr->bSucceeded = ProcessJob(*JobPtr, *Samples, Width, Height, *Calculator, Settings.Export);
+            JobPtr->Seconds = FPlatformTime::Seconds() - StartTime;
+
+            {
+                FScopeLock Lock(&AdmissionLock);
+                --NumRunning;
+                RunningBytes -= JobBytes;
+                IdleCalculators.Push(Calculator);
+
+                UE_LOG(LogTemp, Display, TEXT("Batch: %s %s in %.1f s (%d of %d)"),
+                    JobPtr->bSucceeded ? TEXT("finished") : TEXT("failed"), *JobPtr->HeightmapPath, JobPtr->Seconds, ++NumFinished, Jobs.Num());
+            }
+            JobFinished->Trigger();
+        }));
+    }
+
+    for (TFuture<void>& Task : Tasks)
+    {
+        Task.Wait();
+    }
+
+    FPlatformProcess::ReturnSynchEventToPool(JobFinished);
+    for (UBiomeCalculator* Calculator : AllCalculators)
+    {
+        Calculator->RemoveFromRoot();
+    }
+
+    int32 NumSucceeded = 0;
+    for (const FBiomeBatchJob& Job : Jobs)
+    {
+        NumSucceeded += Job.bSucceeded ? 1 : 0;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("Batch: %d of %d heightmaps succeeded."), NumSucceeded, Jobs.Num());
+    return NumSucceeded == Jobs.Num();
+}
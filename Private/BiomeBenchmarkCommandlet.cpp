@@ -0,0 +1,213 @@
+#include "BiomeBenchmarkCommandlet.h"
+#include "BiomeCalculator.h"
+#include "BiomeISPC.h"
+#include "ClimateKernel.h"
+#include "DistanceToOcean.h"
+#include "SlopeAndAspect.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    /** Fills a grid with fractal sine terrain; cells below sea level are ocean. */
+    void BuildSyntheticGrid(FClimateGrid& Grid, int32 Size, const FInputParameters& InputParams)
+    {
+        Grid.Init(Size, Size);
+
+        for (int32 Y = 0; Y < Size; ++Y)
+        {
+            Grid.RowLatitude[Y] = FMath::Lerp(InputParams.NorthernLatitude, InputParams.SouthernLatitude, (Y + 0.5f) / Size);
+        }
+        for (int32 X = 0; X < Size; ++X)
+        {
+            Grid.ColumnLongitude[X] = FMath::Lerp(-180.0f, 180.0f, (X + 0.5f) / Size);
+        }
+        Grid.Resolution = FVector2D(Size / (InputParams.NorthernLatitude - InputParams.SouthernLatitude), Size / 360.0f);
+
+        ParallelFor(Size, [&](int32 Y)
+        {
+            const float V = static_cast<float>(Y) / Size;
+
+            for (int32 X = 0; X < Size; ++X)
+            {
+                const float U = static_cast<float>(X) / Size;
+
+                float Height = 0.0f;
+                float Amplitude = 2500.0f;
+                float Frequency = 3.0f;
+                for (int32 Octave = 0; Octave < 6; ++Octave)
+                {
+                    Height += Amplitude * FMath::Sin(U * Frequency * TWO_PI + Octave * 1.7f) * FMath::Cos(V * Frequency * 1.3f * TWO_PI + Octave * 0.9f);
+                    Amplitude *= 0.5f;
+                    Frequency *= 2.1f;
+                }
+
+                const int32 Index = Y * Size + X;
+                const bool bIsOcean = Height <= InputParams.SeaLevel;
+                Grid.Altitude[Index] = Height;
+                Grid.OceanDepth[Index] = bIsOcean ? InputParams.SeaLevel - Height : 0.0f;
+                Grid.CellType[Index] = bIsOcean ? ECellType::Ocean : ECellType::Land;
+            }
+        });
+    }
+
+    /** Fastest of several runs of a pass, in seconds; Reset runs before each pass, untimed. */
+    double TimePass(int32 Iterations, TFunctionRef<void()> Reset, TFunctionRef<void()> Pass)
+    {
+        double Fastest = DBL_MAX;
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            Reset();
+            const double StartTime = FPlatformTime::Seconds();
+            Pass();
+            Fastest = FMath::Min(Fastest, FPlatformTime::Seconds() - StartTime);
+        }
+        return Fastest;
+    }
+
+    /** Times a pass on the C++ path, then on the ISPC path. */
+    void TimeBothPaths(int32 Iterations, TFunctionRef<void()> Reset, TFunctionRef<void()> Pass,
+                       TFunctionRef<void()> OnCppFinished, double& OutCppSeconds, double& OutISPCSeconds)
+    {
+        BiomeISPC::SetEnabled(false);
+        OutCppSeconds = TimePass(Iterations, Reset, Pass);
+        OnCppFinished();
+
+        BiomeISPC::SetEnabled(true);
+        OutISPCSeconds = TimePass(Iterations, Reset, Pass);
+    }
+
+    float MaxDifference(const TArray<float>& A, const TArray<float>& B)
+    {
+        float Max = 0.0f;
+        for (int32 i = 0; i < A.Num(); ++i)
+        {
+            Max = FMath::Max(Max, FMath::Abs(A[i] - B[i]));
+        }
+        return Max;
+    }
+
+    /** Largest difference between two planes of angles in degrees, across the 0/360 wrap. */
+    float MaxAngleDifference(const TArray<float>& A, const TArray<float>& B)
+    {
+        float Max = 0.0f;
+        for (int32 i = 0; i < A.Num(); ++i)
+        {
+            const float Difference = FMath::Abs(A[i] - B[i]);
+            Max = FMath::Max(Max, FMath::Min(Difference, 360.0f - Difference));
+        }
+        return Max;
+    }
+
+    void LogResult(const TCHAR* Name, double CppSeconds, double ISPCSeconds, const FString& Difference)
+    {
+        UE_LOG(LogTemp, Display, TEXT("%-20s C++ %9.1f ms   ISPC %9.1f ms   %5.2fx   %s"),
+            Name, CppSeconds * 1000.0, ISPCSeconds * 1000.0, CppSeconds / FMath::Max(ISPCSeconds, 1e-9), *Difference);
+    }
+}
+
+UBiomeBenchmarkCommandlet::UBiomeBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UBiomeBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 Size = 8192;
+    int32 Iterations = 3;
+    FParse::Value(*Params, TEXT("Size="), Size);
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+
+    if (Size < 2 || Iterations < 1 || static_cast<int64>(Size) * Size > MAX_int32)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Usage: -run=BiomeBenchmark [-Size=<2..46340>] [-Iterations=<1..>]"));
+        return 1;
+    }
+
+    if (!BiomeISPC::IsAvailable())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("This build has no ISPC kernels; both paths run the C++ code."));
+    }
+
+    // Wide input ranges, so classification sees most land cells
+    FBiomeSimulationContext Context;
+    Context.InputParams.NorthernLatitude = 60.0f;
+    Context.InputParams.SouthernLatitude = -60.0f;
+    Context.InputParams.MinimumAltitude = 0.0f;
+    Context.InputParams.MaximumAltitude = 5000.0f;
+    Context.InputParams.SeaLevel = 0.0f;
+
+    UE_LOG(LogTemp, Display, TEXT("Building a %dx%d synthetic map..."), Size, Size);
+    FClimateGrid Grid;
+    BuildSyntheticGrid(Grid, Size, Context.InputParams);
+    if (!CalculateDistanceToOcean(Grid))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to compute the distance to ocean of the synthetic map."));
+        return 1;
+    }
+
+    const auto NoReset = []() {};
+    double CppSeconds = 0.0;
+    double ISPCSeconds = 0.0;
+
+    // Slope, aspect, curvature and roughness
+    TArray<float> CppSlope;
+    TArray<float> CppAspect;
+    TArray<float> CppCurvature;
+    TArray<float> CppRoughness;
+    TimeBothPaths(Iterations, NoReset,
+        [&]() { SlopeAndAspect::CalculateSlopeAndAspect(Grid, Context.MathMode); },
+        [&]() { CppSlope = Grid.Slope; CppAspect = Grid.Aspect; CppCurvature = Grid.Curvature; CppRoughness = Grid.Roughness; },
+        CppSeconds, ISPCSeconds);
+    LogResult(TEXT("Terrain stencils"), CppSeconds, ISPCSeconds, FString::Printf(TEXT("max difference: slope %g°, aspect %g°, curvature %g, roughness %g"),
+        MaxDifference(CppSlope, Grid.Slope), MaxAngleDifference(CppAspect, Grid.Aspect),
+        MaxDifference(CppCurvature, Grid.Curvature), MaxDifference(CppRoughness, Grid.Roughness)));
+    CppSlope.Empty();
+    CppAspect.Empty();
+    CppCurvature.Empty();
+    CppRoughness.Empty();
+
+    // Climate kernel, from the same starting fields each run
+    const TArray<float> InitialTemperature = Grid.Temperature;
+    const TArray<float> InitialPrecipitation = Grid.AnnualPrecipitation;
+    const TArray<float> InitialAlbedo = Grid.Albedo;
+    TArray<float> CppTemperature;
+    TArray<float> CppPrecipitation;
+    TArray<float> CppAlbedo;
+    TimeBothPaths(Iterations,
+        [&]() { Grid.Temperature = InitialTemperature; Grid.AnnualPrecipitation = InitialPrecipitation; Grid.Albedo = InitialAlbedo; },
+        [&]() { FClimateKernel::GetDefault().Run(Grid, Context); },
+        [&]() { CppTemperature = Grid.Temperature; CppPrecipitation = Grid.AnnualPrecipitation; CppAlbedo = Grid.Albedo; },
+        CppSeconds, ISPCSeconds);
+    LogResult(TEXT("Climate kernel"), CppSeconds, ISPCSeconds, FString::Printf(TEXT("max difference: %g °C, %g mm, albedo %g"),
+        MaxDifference(CppTemperature, Grid.Temperature), MaxDifference(CppPrecipitation, Grid.AnnualPrecipitation), MaxDifference(CppAlbedo, Grid.Albedo)));
+    CppTemperature.Empty();
+    CppPrecipitation.Empty();
+    CppAlbedo.Empty();
+
+    // Biome classification; only the scoring differs between the paths
+    UBiomeCalculator* Calculator = NewObject<UBiomeCalculator>();
+    Calculator->PrepareLookupTable(Context.InputParams);
+    TArray<EBiomeId> CppBiomes;
+    TimeBothPaths(Iterations, NoReset,
+        [&]()
+        {
+            FBiomeStatistics Statistics;
+            Calculator->ClassifyGrid(Context, -180.0f, 180.0f, Grid, FIntRect(0, 0, Grid.Width, Grid.Height), Statistics);
+        },
+        [&]() { CppBiomes = Grid.BiomeId; },
+        CppSeconds, ISPCSeconds);
+
+    int32 NumDifferentBiomes = 0;
+    for (int32 i = 0; i < Grid.Num(); ++i)
+    {
+        NumDifferentBiomes += CppBiomes[i] != Grid.BiomeId[i] ? 1 : 0;
+    }
+    LogResult(TEXT("Biome classification"), CppSeconds, ISPCSeconds, FString::Printf(TEXT("%d cells classified differently"), NumDifferentBiomes));
+
+    return 0;
+}
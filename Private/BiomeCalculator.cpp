@@ -2,111 +2,302 @@
 #include "BiomeInputShared.h"
 #include "Async/ParallelFor.h"
 #include "BiomeWeightedProbability.h"
-#include "LoggingUtils.h"
-
-// Map of biome colors
-static const TMap<FString, FColor> BiomeColorMap = {
-    {"Tropical Rainforest", FColor::FromHex("#006400")},
-    {"Tropical Monsoon Forests", FColor::FromHex("#228B22")},
-    {"Savanna", FColor::FromHex("#F5DEB3")},
-    {"Temperate Steppe and Savanna", FColor::FromHex("#8b7d63")},
-    {"Temperate Broadleaf", FColor::FromHex("#877116")},
-    {"Subtropical Evergreen Forest", FColor::FromHex("#89b855")},
-    {"Mediterranean", FColor::FromHex("#513058")},
-    {"Xeric Shrubland", FColor::FromHex("#c4947c")},
-    {"Dry Forest and Woodland Savanna", FColor::FromHex("#59463a")},
-    {"Hot Arid Desert", FColor::FromHex("#782713")},
-    {"Tundra", FColor::FromHex("#30abf8")},
-    {"Montane Forests and Grasslands", FColor::FromHex("#077891")},
-    {"Taiga and Boreal Forests", FColor::FromHex("#084f45")},
-    {"Cold or Polar Desert", FColor::FromHex("#D3D3D3")}
-};
-
-int counter = 100;
-FString UBiomeCalculator::CalculateBiome(FHeightmapCell& Cell)
-{
-    // Filter Biomes based on adjusted values
-    TArray<FString> Candidates = FilterBiomeCandidates(Cell.Temperature, Cell.AnnualPrecipitation, Cell.Latitude, Cell.Altitude);
+#include "BiomeDataExporter.h"
+#include "BiomeJobProgress.h"
+#include "Misc/FileHelper.h"
+#include <atomic>
 
-    // Determine the best biome
-    FString Biome = Candidates.Num() > 0 && Candidates[0] != "Unknown Biome"
-                        ? CalculateBiomeProbabilities(Cell.Temperature, Cell.AnnualPrecipitation, Cell.Latitude, Cell.Altitude, Cell.Slope, Cell.Aspect, Candidates)
-                        : "Unknown Biome";
+// Validation logs the details of at most this many mismatching cells per grid
+static constexpr int32 MAX_REPORTED_MISMATCHES = 20;
 
-    // Assign biome type and color to the cell
-    if (!Biome.IsEmpty() && BiomeColorMap.Contains(Biome))
+// Cells without a matching biome are logged at most this many times per classified grid
+static constexpr int32 MAX_NO_CANDIDATE_WARNINGS = 100;
+
+// Shared by the grids of a batch classified concurrently; reset when a grid starts classifying
+static std::atomic<int32> NoCandidateWarningsLeft(MAX_NO_CANDIDATE_WARNINGS);
+
+// Warn when no candidates were found - remove or comment this out if debugging is complete
+static void WarnNoCandidates(float Temperature, float AnnualPrecipitation)
+{
+    // The load keeps the count from wrapping once the warnings have run out
+    if (NoCandidateWarningsLeft.load(std::memory_order_relaxed) > 0 &&
+        NoCandidateWarningsLeft.fetch_sub(1, std::memory_order_relaxed) > 0)
     {
-        Cell.BiomeType = Biome;
-        Cell.BiomeColor = BiomeColorMap[Biome];
+        UE_LOG(LogTemp, Warning, TEXT("No biomes matched for Temp=%.2f, Precip=%.2f"),
+               Temperature, AnnualPrecipitation);
     }
-    else
+}
+
+EBiomeId UBiomeCalculator::ResolveBiome(float Temperature, float AnnualPrecipitation, float Latitude, float Altitude, float Slope, float Aspect)
+{
+    // Filter Biomes based on adjusted values
+    const FBiomeCandidateMask Candidates = FilterBiomeCandidateMask(Temperature, AnnualPrecipitation, Latitude, Altitude);
+
+    if (Candidates == 0)
     {
-        Cell.BiomeType = "Unknown";
-        Cell.BiomeColor = FColor::Black;
+        WarnNoCandidates(Temperature, AnnualPrecipitation);
     }
 
-    return Biome;
-   
+    // Determine the best biome
+    return Candidates != 0
+               ? CalculateBiomeProbabilities(Temperature, AnnualPrecipitation, Latitude, Altitude, Slope, Aspect, Candidates)
+               : EBiomeId::Unknown;
+}
+
+FString UBiomeCalculator::CalculateBiome(FHeightmapCell& Cell)
+{
+    const EBiomeId Biome = ResolveBiome(Cell.Temperature, Cell.AnnualPrecipitation, Cell.Latitude, Cell.Altitude, Cell.Slope, Cell.Aspect);
+
+    // Assign biome type and color to the cell
+    Cell.BiomeType = FBiomeRegistry::GetName(Biome);
+    Cell.BiomeColor = FBiomeRegistry::GetColor(Biome);
+
+    return Cell.BiomeType;
 }
 
 FString UBiomeCalculator::CalculateBiomeFromInput(
-    FInputParameters& InputParams,        
+    const FBiomeSimulationContext& Context,
     float MinLongitude, // Use calculated Min Longitude
     float MaxLongitude, // Use calculated Max Longitude    
-    TArray<FHeightmapCell>& HeightmapData)
+    FClimateGrid& Grid,
+    FBiomeJobProgress* Progress)
 {
-    
+    const FInputParameters& InputParams = Context.InputParams;
+
     // Check for invalid input ranges
     if (InputParams.SouthernLatitude > InputParams.NorthernLatitude || MinLongitude > MaxLongitude || InputParams.MinimumAltitude > InputParams.MaximumAltitude)
     {
         return "Invalid input ranges provided.";
     }
 
-    TMap<FString, int32> UniqueBiomes;
-    FCriticalSection ResultMutex;
+    PrepareLookupTable(InputParams);
+
+    FBiomeStatistics Statistics;
+    ClassifyGrid(Context, MinLongitude, MaxLongitude, Grid, FIntRect(0, 0, Grid.Width, Grid.Height), Statistics, Progress);
+
+    if (IsJobCancelled(Progress))
+    {
+        return "Biome calculation cancelled.";
+    }
 
-    ParallelFor(HeightmapData.Num(), [&](int32 Index)
+    if (Progress)
     {
-        FHeightmapCell& Cell = HeightmapData[Index];
+        Progress->BeginStage(TEXT("Writing results"));
+    }
+
+    // Per-cell export is opt-in; the latitude band statistics are written next to it
+    if (ExportSettings.bEnabled && FBiomeDataExporter::Export(Grid, ExportSettings, FPaths::ProjectDir()))
+    {
+        const FString Directory = FBiomeDataExporter::ResolveOutputDirectory(ExportSettings, FPaths::ProjectDir());
+        FFileHelper::SaveStringToFile(Statistics.FormatLatitudeBandsCSV(), *FPaths::Combine(Directory, TEXT("BiomeLatitudeBands.csv")));
+    }
+
+    return FormatBiomeSummary(Statistics);
+}
+
+void UBiomeCalculator::ClassifyGrid(
+    const FBiomeSimulationContext& Context,
+    float MinLongitude,
+    float MaxLongitude,
+    FClimateGrid& Grid,
+    const FIntRect& Region,
+    FBiomeStatistics& InOutStatistics,
+    FBiomeJobProgress* Progress)
+{
+    const FInputParameters& InputParams = Context.InputParams;
+    const int32 RegionWidth = Region.Width();
+    const int32 NumBatches = FMath::DivideAndRoundUp(Region.Area(), BIOME_SCORE_BATCH_SIZE);
+
+    if (Progress)
+    {
+        Progress->BeginStage(TEXT("Classifying biomes"), NumBatches);
+    }
+
+    const bool bUseLookupTable = LookupTableSettings.bEnabled && LookupTable.IsBuilt();
+    const bool bValidate = bUseLookupTable && LookupTableSettings.bValidate;
+    std::atomic<int32> NumClassified(0);
+    std::atomic<int32> NumMismatches(0);
+    NoCandidateWarningsLeft.store(MAX_NO_CANDIDATE_WARNINGS, std::memory_order_relaxed);
+
+    // Latitude is constant along a row, so the statistics band and area weight are too
+    TArray<int32> RowBand;
+    TArray<double> RowAreaWeight;
+    RowBand.SetNumUninitialized(Region.Height());
+    RowAreaWeight.SetNumUninitialized(Region.Height());
+    for (int32 Row = 0; Row < Region.Height(); ++Row)
+    {
+        const float Latitude = Grid.RowLatitude[Region.Min.Y + Row];
+        RowBand[Row] = FBiomeStatistics::GetLatitudeBand(Latitude);
+        RowAreaWeight[Row] = FBiomeStatistics::GetAreaWeight(Latitude);
+    }
+
+    // Each worker counts into its own statistics, merged once the pass is done
+    TArray<FBiomeStatistics> WorkerStatistics;
+
+    // Each task gathers the classified cells of a run of the region into a batch and scores them together
+    ParallelForWithTaskContext(WorkerStatistics, NumBatches, [&](FBiomeStatistics& Statistics, int32 BatchIndex)
+    {
+        if (IsJobCancelled(Progress))
+        {
+            return;
+        }
+
+        const int32 FirstRegionIndex = BatchIndex * BIOME_SCORE_BATCH_SIZE;
+        const int32 LastRegionIndex = FMath::Min(FirstRegionIndex + BIOME_SCORE_BATCH_SIZE, Region.Area());
+
+        FBiomeScoreBatch Batch;
+        int32 CellIndices[BIOME_SCORE_BATCH_SIZE];
+        EBiomeId Biomes[BIOME_SCORE_BATCH_SIZE];
+        int32 NumCells = 0;
+
+        for (int32 RegionIndex = FirstRegionIndex; RegionIndex < LastRegionIndex; ++RegionIndex)
+        {
+            const int32 Index = (Region.Min.Y + RegionIndex / RegionWidth) * Grid.Width + Region.Min.X + RegionIndex % RegionWidth;
+            const float Latitude = Grid.GetLatitude(Index);
+            const float Longitude = Grid.GetLongitude(Index);
+            const float Altitude = Grid.Altitude[Index];
+
+            if (Grid.CellType[Index] == ECellType::Land &&
+                Latitude >= InputParams.SouthernLatitude && Latitude <= InputParams.NorthernLatitude &&
+                Longitude >= MinLongitude && Longitude <= MaxLongitude &&
+                Altitude >= InputParams.MinimumAltitude && Altitude <= InputParams.MaximumAltitude)
+            {
+                CellIndices[NumCells] = Index;
+                Batch.Temperature[NumCells] = Grid.Temperature[Index];
+                Batch.Precipitation[NumCells] = Grid.AnnualPrecipitation[Index];
+                Batch.Latitude[NumCells] = Latitude;
+                Batch.Altitude[NumCells] = Altitude;
+                Batch.Slope[NumCells] = Grid.Slope[Index];
+                Batch.Aspect[NumCells] = Grid.Aspect[Index];
+                NumCells++;
+            }
+        }
+
+        if (bUseLookupTable)
+        {
+            for (int32 Cell = 0; Cell < NumCells; ++Cell)
+            {
+                Biomes[Cell] = LookupTable.Classify(Batch.Temperature[Cell], Batch.Precipitation[Cell], Batch.Latitude[Cell],
+                                                    Batch.Altitude[Cell], Batch.Slope[Cell], Batch.Aspect[Cell]);
+            }
+        }
+
+        if (!bUseLookupTable || bValidate)
+        {
+            for (int32 Cell = 0; Cell < NumCells; ++Cell)
+            {
+                Batch.Candidates[Cell] = FilterBiomeCandidateMask(Batch.Temperature[Cell], Batch.Precipitation[Cell], Batch.Latitude[Cell], Batch.Altitude[Cell]);
+                if (Batch.Candidates[Cell] == 0)
+                {
+                    WarnNoCandidates(Batch.Temperature[Cell], Batch.Precipitation[Cell]);
+                }
+            }
+        }
 
-        if (Cell.CellType == ECellType::Land &&
-            Cell.Latitude >= InputParams.SouthernLatitude && Cell.Latitude <= InputParams.NorthernLatitude &&
-            Cell.Longitude >= MinLongitude && Cell.Longitude <= MaxLongitude &&
-            Cell.Altitude >= InputParams.MinimumAltitude && Cell.Altitude <= InputParams.MaximumAltitude)
+        if (!bUseLookupTable)
+        {
+            CalculateBiomeProbabilitiesBatch(Batch, NumCells, Biomes, Context.MathMode);
+        }
+        else if (bValidate)
         {
-            FString Biome = CalculateBiome(Cell);
+            EBiomeId ExactBiomes[BIOME_SCORE_BATCH_SIZE];
+            CalculateBiomeProbabilitiesBatch(Batch, NumCells, ExactBiomes, Context.MathMode);
+            NumClassified += NumCells;
 
-            if(!Biome.IsEmpty())
+            for (int32 Cell = 0; Cell < NumCells; ++Cell)
             {
-               FScopeLock Lock(&ResultMutex); 
-               UniqueBiomes.FindOrAdd(Biome)++;
-            }            
+                if (ExactBiomes[Cell] != Biomes[Cell] && NumMismatches++ < MAX_REPORTED_MISMATCHES)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("Lookup table mismatch at cell %d (T=%.2f, P=%.2f, Lat=%.2f, Alt=%.2f, Slope=%.2f, Aspect=%.2f): table %s, exact %s"),
+                        CellIndices[Cell], Batch.Temperature[Cell], Batch.Precipitation[Cell], Batch.Latitude[Cell],
+                        Batch.Altitude[Cell], Batch.Slope[Cell], Batch.Aspect[Cell],
+                        *FBiomeRegistry::GetName(Biomes[Cell]), *FBiomeRegistry::GetName(ExactBiomes[Cell]));
+                }
+            }
+        }
+
+        for (int32 Cell = 0; Cell < NumCells; ++Cell)
+        {
+            Grid.BiomeId[CellIndices[Cell]] = Biomes[Cell];
+
+            const int32 Row = CellIndices[Cell] / Grid.Width - Region.Min.Y;
+            Statistics.Add(Biomes[Cell], RowBand[Row], RowAreaWeight[Row]);
+        }
+
+        if (Progress)
+        {
+            Progress->AddWork();
         }
     });
 
-    // Log data to CSV after processing
-    FString LogFilePath = FPaths::ProjectDir() + TEXT("BiomeDataLog.csv");
-    LogBiomeDataToCSV(HeightmapData, LogFilePath);
+    for (const FBiomeStatistics& Statistics : WorkerStatistics)
+    {
+        InOutStatistics.Merge(Statistics);
+    }
 
-    if (UniqueBiomes.Num() == 0)
+    if (bValidate)
     {
-        return "No valid data found in the provided heightmap.";
+        UE_LOG(LogTemp, Log, TEXT("Lookup table validation: %d of %d classified cells differ from the exact path."),
+            NumMismatches.load(), NumClassified.load());
     }
+}
+
+void UBiomeCalculator::PrepareLookupTable(const FInputParameters& InputParams)
+{
+    LookupTable.Empty();
 
-    FString FinalBiomes = "Detected Biomes \n";
-    for (const TPair<FString, int32>& Pair : UniqueBiomes)
+    if (LookupTableSettings.bEnabled)
     {
-        FinalBiomes += FString::Printf(TEXT("%s: %d occurrences\n"), *Pair.Key, Pair.Value);
+        LookupTable.Build(LookupTableSettings, InputParams);
     }
+}
 
-    return FinalBiomes;
+FString UBiomeCalculator::FormatBiomeSummary(const FBiomeStatistics& Statistics)
+{
+    FString Summary;
+    for (int32 Index = 0; Index < FBiomeRegistry::Num(); ++Index)
+    {
+        if (Statistics.Counts[Index] > 0)
+        {
+            const EBiomeId Biome = static_cast<EBiomeId>(Index);
+            Summary += FString::Printf(TEXT("%s: %lld occurrences, %.1f%% of area\n"),
+                *FBiomeRegistry::GetName(Biome), Statistics.Counts[Index], 100.0 * Statistics.GetCoverage(Biome));
+        }
+    }
+
+    if (Summary.IsEmpty())
+    {
+        return "No valid data found in the provided heightmap.";
+    }
+
+    return "Detected Biomes \n" + Summary;
 }
 
 TArray<FString> UBiomeCalculator::FilterBiomeCandidates(float AdjustedTemperature, float Precipitation, float Latitude, float Altitude)
 {
-    // Array of candidate biomes
+    // Array of candidate biome names, for Blueprint callers
     TArray<FString> Candidates;
 
+    FBiomeCandidateMask Mask = FilterBiomeCandidateMask(AdjustedTemperature, Precipitation, Latitude, Altitude);
+    while (Mask != 0)
+    {
+        Candidates.Add(FBiomeRegistry::GetName(static_cast<EBiomeId>(FMath::CountTrailingZeros(Mask))));
+        Mask &= Mask - 1;
+    }
+
+    if (Candidates.Num() == 0)
+    {
+        Candidates.Add(FBiomeRegistry::GetName(EBiomeId::Unknown));
+    }
+
+    return Candidates;
+}
+
+FBiomeCandidateMask UBiomeCalculator::FilterBiomeCandidateMask(float AdjustedTemperature, float Precipitation, float Latitude, float Altitude)
+{
+    // Mask of candidate biomes
+    FBiomeCandidateMask Candidates = 0;
+
    // Biome classification logic
    // Apply latitude modifiers for temperature thresholds
     bool IsTropical = (Latitude >= -23.5f && Latitude <= 23.5f);
@@ -115,35 +306,37 @@ TArray<FString> UBiomeCalculator::FilterBiomeCandidates(float AdjustedTemperatur
 
     // Criteria based on the lowest ever recorded Real World data in order to create a threshold.
 
-    if (AdjustedTemperature >= 20.0f && AdjustedTemperature >= 30.0f && Precipitation >= 1750.0f && Altitude >= 1000.0f && IsTropical ) Candidates.Add("Tropical Rainforest");
-    if (AdjustedTemperature >= 15.0f && Precipitation >= 750.0f && Precipitation <= 2000.0f && IsTropical ) Candidates.Add( "Tropical Monsoon Forests");
-    if (AdjustedTemperature >= 15.0f && Precipitation >= 500.0f && Precipitation <= 1000.0f && IsTropical ) Candidates.Add( "Savanna"); //More tropical. Hot wet summer and cooler dry winters    
-    if (AdjustedTemperature >= 0.0f && AdjustedTemperature <= 30.0f && Precipitation >= 250.0f && Precipitation <= 750.0f && IsTemperate ) Candidates.Add( "Temperate Steppe and Savanna");// Semiarid transition between grassland and desert. Short grasses, hot summers and cold winters
-    if (AdjustedTemperature >= 10.0f && AdjustedTemperature <= 20.0f && Precipitation >= 750.0f && Precipitation <= 1500.0f && IsTemperate  ) Candidates.Add( "Temperate Broadleaf");    
-    if (AdjustedTemperature >= 10.0f && Precipitation >= 1000.0f && IsTemperate  ) Candidates.Add( "Subtropical Evergreen Forest");
-    if (AdjustedTemperature > 10.0f && AdjustedTemperature <= 45.0f && Precipitation >= 250.0f && Precipitation <= 900.0f && IsTemperate ) Candidates.Add( "Mediterranean");
-    if (AdjustedTemperature >= 0.0f && Precipitation <= 250.0f) Candidates.Add( "Xeric Shrubland");// similar to mediterranean but drier. Xeric actually means dry
-    if (AdjustedTemperature >= 0.0f && Precipitation >= 250.0f && Precipitation <= 500.0f && !IsPolar  ) Candidates.Add( "Dry Forest and Woodland Savanna");   
-    if (AdjustedTemperature > 25.0f && Precipitation < 250.0f) Candidates.Add( "Hot Arid Desert");
-    if (AdjustedTemperature < 12.0f && Altitude >= 1850.0f ) Candidates.Add( "Tundra");// Polar Tundra    
-    if (AdjustedTemperature <= 15.0f && Precipitation > 1000.0f && Altitude > 1500.0f ) Candidates.Add( "Montane Forests and Grasslands");
-    if (AdjustedTemperature <= 15.0f && Precipitation >= 500.0f && Precipitation <= 1500.0f && IsPolar ) Candidates.Add( "Taiga (Boreal Forest)");       
-    if (AdjustedTemperature < 5.0f && Precipitation < 250.0f && IsPolar) Candidates.Add("Cold or Polar Desert");
-
-    // Add a fallback if no candidates were found - remove or comment this out if debugging is complete
-    
-    if (Candidates.Num() == 0 && counter > 0)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("No biomes matched for Temp=%.2f, Precip=%.2f"),
-               AdjustedTemperature, Precipitation);
-        Candidates.Add("Unknown Biome");
-
-        counter--;
-    }
+    if (AdjustedTemperature >= 20.0f && AdjustedTemperature >= 30.0f && Precipitation >= 1750.0f && Altitude >= 1000.0f && IsTropical ) Candidates |= BiomeMaskBit(EBiomeId::TropicalRainforest);
+    if (AdjustedTemperature >= 15.0f && Precipitation >= 750.0f && Precipitation <= 2000.0f && IsTropical ) Candidates |= BiomeMaskBit(EBiomeId::TropicalMonsoonForests);
+    if (AdjustedTemperature >= 15.0f && Precipitation >= 500.0f && Precipitation <= 1000.0f && IsTropical ) Candidates |= BiomeMaskBit(EBiomeId::Savanna); //More tropical. Hot wet summer and cooler dry winters    
+    if (AdjustedTemperature >= 0.0f && AdjustedTemperature <= 30.0f && Precipitation >= 250.0f && Precipitation <= 750.0f && IsTemperate ) Candidates |= BiomeMaskBit(EBiomeId::TemperateSteppeAndSavanna);// Semiarid transition between grassland and desert. Short grasses, hot summers and cold winters
+    if (AdjustedTemperature >= 10.0f && AdjustedTemperature <= 20.0f && Precipitation >= 750.0f && Precipitation <= 1500.0f && IsTemperate  ) Candidates |= BiomeMaskBit(EBiomeId::TemperateBroadleaf);    
+    if (AdjustedTemperature >= 10.0f && Precipitation >= 1000.0f && IsTemperate  ) Candidates |= BiomeMaskBit(EBiomeId::SubtropicalEvergreenForest);
+    if (AdjustedTemperature > 10.0f && AdjustedTemperature <= 45.0f && Precipitation >= 250.0f && Precipitation <= 900.0f && IsTemperate ) Candidates |= BiomeMaskBit(EBiomeId::Mediterranean);
+    if (AdjustedTemperature >= 0.0f && Precipitation <= 250.0f) Candidates |= BiomeMaskBit(EBiomeId::XericShrubland);// similar to mediterranean but drier. Xeric actually means dry
+    if (AdjustedTemperature >= 0.0f && Precipitation >= 250.0f && Precipitation <= 500.0f && !IsPolar  ) Candidates |= BiomeMaskBit(EBiomeId::DryForestAndWoodlandSavanna);   
+    if (AdjustedTemperature > 25.0f && Precipitation < 250.0f) Candidates |= BiomeMaskBit(EBiomeId::HotAridDesert);
+    if (AdjustedTemperature < 12.0f && Altitude >= 1850.0f ) Candidates |= BiomeMaskBit(EBiomeId::Tundra);// Polar Tundra    
+    if (AdjustedTemperature <= 15.0f && Precipitation > 1000.0f && Altitude > 1500.0f ) Candidates |= BiomeMaskBit(EBiomeId::MontaneForestsAndGrasslands);
+    if (AdjustedTemperature <= 15.0f && Precipitation >= 500.0f && Precipitation <= 1500.0f && IsPolar ) Candidates |= BiomeMaskBit(EBiomeId::TaigaBorealForest);       
+    if (AdjustedTemperature < 5.0f && Precipitation < 250.0f && IsPolar) Candidates |= BiomeMaskBit(EBiomeId::ColdOrPolarDesert);
 
     return Candidates;
 }
 
+void UBiomeCalculator::GetCandidateThresholds(
+    TArray<float>& OutTemperature,
+    TArray<float>& OutPrecipitation,
+    TArray<float>& OutLatitude,
+    TArray<float>& OutAltitude)
+{
+    // Keep in sync with the rules in FilterBiomeCandidateMask
+    OutTemperature = { 0.0f, 5.0f, 10.0f, 12.0f, 15.0f, 20.0f, 25.0f, 30.0f, 45.0f };
+    OutPrecipitation = { 250.0f, 500.0f, 750.0f, 900.0f, 1000.0f, 1500.0f, 1750.0f, 2000.0f };
+    OutLatitude = { 23.5f, 60.0f };
+    OutAltitude = { 1000.0f, 1500.0f, 1850.0f };
+}
+
 /*
 FInputParameters UBiomeCalculator::GetInputParameters() const
 {
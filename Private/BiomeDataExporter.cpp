@@ -0,0 +1,393 @@
+#include "BiomeDataExporter.h"
+#include "Algo/Find.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include <type_traits>
+
+// Cells formatted per CSV chunk; each worker fills one chunk buffer at a time
+static constexpr int32 CSV_CHUNK_CELLS = 16384;
+
+// Identifies a column file and its layout version
+static constexpr uint32 COLUMN_FILE_MAGIC = 0x4C434D42; // "BMCL"
+static constexpr uint16 COLUMN_FILE_VERSION = 1;
+
+namespace
+{
+    struct FColumnInfo
+    {
+        EBiomeDataColumn Column;
+        const TCHAR* Name;
+    };
+
+    // CSV column order
+    const FColumnInfo ColumnInfos[] =
+    {
+        { EBiomeDataColumn::CellIndex, TEXT("CellIndex") },
+        { EBiomeDataColumn::Latitude, TEXT("Latitude") },
+        { EBiomeDataColumn::Longitude, TEXT("Longitude") },
+        { EBiomeDataColumn::Altitude, TEXT("Altitude") },
+        { EBiomeDataColumn::Temperature, TEXT("Temperature") },
+        { EBiomeDataColumn::Precipitation, TEXT("Precipitation") },
+        { EBiomeDataColumn::Slope, TEXT("Slope") },
+        { EBiomeDataColumn::Aspect, TEXT("Aspect") },
+        { EBiomeDataColumn::Biome, TEXT("Biome") },
+        { EBiomeDataColumn::DistanceToOcean, TEXT("DistanceToOcean") },
+        { EBiomeDataColumn::Albedo, TEXT("Albedo") },
+        { EBiomeDataColumn::ClosestOceanTemperature, TEXT("ClosestOceanTemperature") },
+        { EBiomeDataColumn::Curvature, TEXT("Curvature") },
+        { EBiomeDataColumn::Roughness, TEXT("Roughness") },
+    };
+
+    /** What a column file's values are indexed by. */
+    enum class EColumnAxis : uint8
+    {
+        Cell,
+        Row,
+        Column
+    };
+
+    /** Header at the start of every column file, followed by the plane. */
+    struct FColumnFileHeader
+    {
+        uint32 Magic = COLUMN_FILE_MAGIC;
+        uint16 Version = COLUMN_FILE_VERSION;
+        uint8 ElementSize = 0;
+        EColumnAxis Axis = EColumnAxis::Cell;
+        int32 Width = 0;
+        int32 Height = 0;
+    };
+    static_assert(sizeof(FColumnFileHeader) == 16, "Column file header layout changed");
+
+    EColumnAxis GetColumnAxis(EBiomeDataColumn Column)
+    {
+        return Column == EBiomeDataColumn::Latitude ? EColumnAxis::Row :
+               Column == EBiomeDataColumn::Longitude ? EColumnAxis::Column : EColumnAxis::Cell;
+    }
+
+    int32 GetColumnElementSize(EBiomeDataColumn Column)
+    {
+        return Column == EBiomeDataColumn::Biome ? sizeof(EBiomeId) : sizeof(float);
+    }
+
+    int64 GetColumnNum(EColumnAxis Axis, int32 Width, int32 Height)
+    {
+        return Axis == EColumnAxis::Row ? Height :
+               Axis == EColumnAxis::Column ? Width : static_cast<int64>(Width) * Height;
+    }
+
+    /** Plane backing a column, as bytes; const for a const grid. Null for CellIndex, which is not stored. */
+    template <typename GridType>
+    auto* GetColumnData(GridType& Grid, EBiomeDataColumn Column)
+    {
+        using ByteType = std::conditional_t<std::is_const_v<GridType>, const uint8, uint8>;
+        switch (Column)
+        {
+        case EBiomeDataColumn::Latitude:                return reinterpret_cast<ByteType*>(Grid.RowLatitude.GetData());
+        case EBiomeDataColumn::Longitude:               return reinterpret_cast<ByteType*>(Grid.ColumnLongitude.GetData());
+        case EBiomeDataColumn::Altitude:                return reinterpret_cast<ByteType*>(Grid.Altitude.GetData());
+        case EBiomeDataColumn::Temperature:             return reinterpret_cast<ByteType*>(Grid.Temperature.GetData());
+        case EBiomeDataColumn::Precipitation:           return reinterpret_cast<ByteType*>(Grid.AnnualPrecipitation.GetData());
+        case EBiomeDataColumn::Slope:                   return reinterpret_cast<ByteType*>(Grid.Slope.GetData());
+        case EBiomeDataColumn::Aspect:                  return reinterpret_cast<ByteType*>(Grid.Aspect.GetData());
+        case EBiomeDataColumn::Biome:                   return reinterpret_cast<ByteType*>(Grid.BiomeId.GetData());
+        case EBiomeDataColumn::DistanceToOcean:         return reinterpret_cast<ByteType*>(Grid.DistanceToOcean.GetData());
+        case EBiomeDataColumn::Albedo:                  return reinterpret_cast<ByteType*>(Grid.Albedo.GetData());
+        case EBiomeDataColumn::ClosestOceanTemperature: return reinterpret_cast<ByteType*>(Grid.ClosestOceanTemperature.GetData());
+        case EBiomeDataColumn::Curvature:               return reinterpret_cast<ByteType*>(Grid.Curvature.GetData());
+        case EBiomeDataColumn::Roughness:               return reinterpret_cast<ByteType*>(Grid.Roughness.GetData());
+        default:                                        return static_cast<ByteType*>(nullptr);
+        }
+    }
+
+    /** Appends a formatted value to a row; Printf-style but into ANSI chars with no allocation. */
+    template <typename... ArgTypes>
+    void AppendFormatted(TArray<ANSICHAR>& Out, const ANSICHAR* Format, ArgTypes... Args)
+    {
+        ANSICHAR Value[64];
+        const int32 Length = FCStringAnsi::Snprintf(Value, UE_ARRAY_COUNT(Value), Format, Args...);
+        Out.Append(Value, FMath::Clamp(Length, 0, static_cast<int32>(UE_ARRAY_COUNT(Value)) - 1));
+    }
+
+    bool WriteBytes(IFileHandle& Handle, const void* Data, int64 NumBytes)
+    {
+        return Handle.Write(static_cast<const uint8*>(Data), NumBytes);
+    }
+}
+
+FString FBiomeDataExporter::ResolveOutputPath(const FBiomeDataExportSettings& Settings, const FString& DefaultDirectory)
+{
+    FString OutputPath = Settings.OutputPath;
+    if (OutputPath.IsEmpty())
+    {
+        OutputPath = Settings.Format == EBiomeDataFormat::CSV ? TEXT("BiomeDataLog.csv") : TEXT("BiomeData");
+    }
+    if (FPaths::IsRelative(OutputPath))
+    {
+        OutputPath = FPaths::Combine(DefaultDirectory, OutputPath);
+    }
+    return OutputPath;
+}
+
+FString FBiomeDataExporter::ResolveOutputDirectory(const FBiomeDataExportSettings& Settings, const FString& DefaultDirectory)
+{
+    const FString OutputPath = ResolveOutputPath(Settings, DefaultDirectory);
+    return Settings.Format == EBiomeDataFormat::CSV ? FPaths::GetPath(OutputPath) : OutputPath;
+}
+
+bool FBiomeDataExporter::Export(const FClimateGrid& Grid, const FBiomeDataExportSettings& Settings, const FString& DefaultDirectory)
+{
+    const FString OutputPath = ResolveOutputPath(Settings, DefaultDirectory);
+
+    const double StartTime = FPlatformTime::Seconds();
+    const bool bExported = Settings.Format == EBiomeDataFormat::CSV
+        ? ExportCSV(Grid, Settings.Columns, Settings.bSkipZeroAltitude, OutputPath)
+        : ExportColumnar(Grid, Settings.Columns, OutputPath);
+
+    if (bExported)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Biome data exported to %s in %.2f s"), *OutputPath, FPlatformTime::Seconds() - StartTime);
+    }
+    return bExported;
+}
+
+bool FBiomeDataExporter::ExportCSV(const FClimateGrid& Grid, EBiomeDataColumn Columns, bool bSkipZeroAltitude, const FString& FilePath)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+
+    TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*FilePath));
+    if (!Handle.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write biome data to file: %s"), *FilePath);
+        return false;
+    }
+
+    // Header
+    FString Header;
+    for (const FColumnInfo& Info : ColumnInfos)
+    {
+        if (EnumHasAnyFlags(Columns, Info.Column))
+        {
+            Header += Header.IsEmpty() ? Info.Name : FString(TEXT(",")) + Info.Name;
+        }
+    }
+    Header += TEXT("\n");
+
+    const FTCHARToUTF8 HeaderUTF8(*Header);
+    bool bWritten = WriteBytes(*Handle, HeaderUTF8.Get(), HeaderUTF8.Length());
+
+    // Biome names are converted once rather than per row
+    TArray<TArray<ANSICHAR>> BiomeNames;
+    BiomeNames.SetNum(FBiomeRegistry::Num());
+    for (int32 Index = 0; Index < FBiomeRegistry::Num(); ++Index)
+    {
+        const FTCHARToUTF8 Name(*FBiomeRegistry::GetName(static_cast<EBiomeId>(Index)));
+        BiomeNames[Index].Append(Name.Get(), Name.Length());
+    }
+
+    // Format a window of chunks in parallel, then write them in order; the buffers are reused across windows
+    const int32 NumChunks = FMath::DivideAndRoundUp(Grid.Num(), CSV_CHUNK_CELLS);
+    const int32 WindowSize = FMath::Max(2 * FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1);
+    TArray<TArray<ANSICHAR>> ChunkBuffers;
+    ChunkBuffers.SetNum(FMath::Min(WindowSize, NumChunks));
+
+    for (int32 FirstChunk = 0; FirstChunk < NumChunks && bWritten; FirstChunk += WindowSize)
+    {
+        const int32 NumWindowChunks = FMath::Min(WindowSize, NumChunks - FirstChunk);
+
+        ParallelFor(NumWindowChunks, [&](int32 WindowIndex)
+        {
+            TArray<ANSICHAR>& Out = ChunkBuffers[WindowIndex];
+            Out.Reset();
+
+            const int32 FirstCell = (FirstChunk + WindowIndex) * CSV_CHUNK_CELLS;
+            const int32 LastCell = FMath::Min(FirstCell + CSV_CHUNK_CELLS, Grid.Num());
+
+            for (int32 CellIndex = FirstCell; CellIndex < LastCell; ++CellIndex)
+            {
+                if (bSkipZeroAltitude && Grid.Altitude[CellIndex] == 0)
+                {
+                    continue;
+                }
+
+                bool bFirstColumn = true;
+                for (const FColumnInfo& Info : ColumnInfos)
+                {
+                    if (!EnumHasAnyFlags(Columns, Info.Column))
+                    {
+                        continue;
+                    }
+
+                    if (!bFirstColumn)
+                    {
+                        Out.Add(',');
+                    }
+                    bFirstColumn = false;
+
+                    switch (Info.Column)
+                    {
+                    case EBiomeDataColumn::CellIndex: AppendFormatted(Out, "%d", CellIndex); break;
+                    case EBiomeDataColumn::Latitude:  AppendFormatted(Out, "%f", Grid.GetLatitude(CellIndex)); break;
+                    case EBiomeDataColumn::Longitude: AppendFormatted(Out, "%f", Grid.GetLongitude(CellIndex)); break;
+                    case EBiomeDataColumn::Biome:     Out.Append(BiomeNames[static_cast<int32>(Grid.BiomeId[CellIndex])]); break;
+                    default:
+                        AppendFormatted(Out, "%f", reinterpret_cast<const float*>(GetColumnData(Grid, Info.Column))[CellIndex]);
+                        break;
+                    }
+                }
+                Out.Add('\n');
+            }
+        });
+
+        for (int32 WindowIndex = 0; WindowIndex < NumWindowChunks && bWritten; ++WindowIndex)
+        {
+            bWritten = WriteBytes(*Handle, ChunkBuffers[WindowIndex].GetData(), ChunkBuffers[WindowIndex].Num());
+        }
+    }
+
+    if (!bWritten)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write biome data to file: %s"), *FilePath);
+    }
+    return bWritten;
+}
+
+bool FBiomeDataExporter::ExportColumnar(const FClimateGrid& Grid, EBiomeDataColumn Columns, const FString& Directory)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.CreateDirectoryTree(*Directory))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to create biome data directory: %s"), *Directory);
+        return false;
+    }
+
+    for (const FColumnInfo& Info : ColumnInfos)
+    {
+        const uint8* Data = GetColumnData(Grid, Info.Column);
+        if (!EnumHasAnyFlags(Columns, Info.Column) || Data == nullptr)
+        {
+            continue;
+        }
+
+        FColumnFileHeader Header;
+        Header.ElementSize = GetColumnElementSize(Info.Column);
+        Header.Axis = GetColumnAxis(Info.Column);
+        Header.Width = Grid.Width;
+        Header.Height = Grid.Height;
+
+        const FString FilePath = FPaths::Combine(Directory, FString(Info.Name) + TEXT(".bmc"));
+        TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*FilePath));
+
+        if (!Handle.IsValid() ||
+            !WriteBytes(*Handle, &Header, sizeof(Header)) ||
+            !WriteBytes(*Handle, Data, GetColumnNum(Header.Axis, Grid.Width, Grid.Height) * Header.ElementSize))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to write biome data column: %s"), *FilePath);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FBiomeDataExporter::LoadColumnar(const FString& Directory, FClimateGrid& OutGrid, EBiomeDataColumn& OutColumns)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    OutColumns = EBiomeDataColumn::None;
+
+    for (const FColumnInfo& Info : ColumnInfos)
+    {
+        const FString FilePath = FPaths::Combine(Directory, FString(Info.Name) + TEXT(".bmc"));
+        TUniquePtr<IFileHandle> Handle(PlatformFile.OpenRead(*FilePath));
+        if (!Handle.IsValid())
+        {
+            continue;
+        }
+
+        FColumnFileHeader Header;
+        if (!Handle->Read(reinterpret_cast<uint8*>(&Header), sizeof(Header)) ||
+            Header.Magic != COLUMN_FILE_MAGIC || Header.Version != COLUMN_FILE_VERSION ||
+            Header.ElementSize != GetColumnElementSize(Info.Column) || Header.Axis != GetColumnAxis(Info.Column))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Not a biome data column file: %s"), *FilePath);
+            return false;
+        }
+
+        // Check the header against the file before it sizes any allocation
+        const int64 NumBytes = GetColumnNum(Header.Axis, Header.Width, Header.Height) * Header.ElementSize;
+        if (Header.Width <= 0 || Header.Height <= 0 ||
+            static_cast<int64>(Header.Width) * Header.Height > MAX_int32 ||
+            Handle->Size() != static_cast<int64>(sizeof(Header)) + NumBytes)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Biome data column %s has an invalid size for %dx%d cells"),
+                *FilePath, Header.Width, Header.Height);
+            return false;
+        }
+
+        // The first column found sizes the grid; the rest must match it
+        if (OutColumns == EBiomeDataColumn::None)
+        {
+            OutGrid.Init(Header.Width, Header.Height);
+        }
+        else if (Header.Width != OutGrid.Width || Header.Height != OutGrid.Height)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Biome data column %s is %dx%d, expected %dx%d"),
+                *FilePath, Header.Width, Header.Height, OutGrid.Width, OutGrid.Height);
+            return false;
+        }
+
+        // Read straight into the plane
+        if (!Handle->Read(GetColumnData(OutGrid, Info.Column), NumBytes))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Biome data column is truncated: %s"), *FilePath);
+            return false;
+        }
+
+        OutColumns |= Info.Column;
+    }
+
+    if (OutColumns == EBiomeDataColumn::None)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No biome data columns found in %s"), *Directory);
+        return false;
+    }
+
+    return true;
+}
+
+bool FBiomeDataExporter::ParseColumns(const FString& Names, EBiomeDataColumn& OutColumns)
+{
+    TArray<FString> Tokens;
+    Names.ParseIntoArray(Tokens, TEXT(","));
+
+    OutColumns = EBiomeDataColumn::None;
+    for (const FString& RawToken : Tokens)
+    {
+        const FString Token = RawToken.TrimStartAndEnd();
+        if (Token.Equals(TEXT("All"), ESearchCase::IgnoreCase))
+        {
+            OutColumns |= EBiomeDataColumn::All;
+            continue;
+        }
+        if (Token.Equals(TEXT("Default"), ESearchCase::IgnoreCase))
+        {
+            OutColumns |= EBiomeDataColumn::Default;
+            continue;
+        }
+
+        const FColumnInfo* Info = Algo::FindByPredicate(ColumnInfos, [&Token](const FColumnInfo& Candidate)
+        {
+            return Token.Equals(Candidate.Name, ESearchCase::IgnoreCase);
+        });
+
+        if (Info == nullptr)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Unknown biome data column: %s"), *Token);
+            return false;
+        }
+        OutColumns |= Info->Column;
+    }
+
+    return OutColumns != EBiomeDataColumn::None;
+}
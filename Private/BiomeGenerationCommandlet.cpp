@@ -0,0 +1,174 @@
+#include "BiomeGenerationCommandlet.h"
+#include "BiomeBatchScheduler.h"
+#include "TiledBiomePipeline.h"
+#include "BiomeISPC.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UBiomeGenerationCommandlet::UBiomeGenerationCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+FInputParameters UBiomeGenerationCommandlet::ParseInputParameters(const FString& Params)
+{
+    // Same defaults as the editor sliders
+    FInputParameters InputParams;
+    InputParams.NorthernLatitude = 35.0f;
+    InputParams.SouthernLatitude = 25.0f;
+    InputParams.CentralLongitude = 0.0f;
+    InputParams.MinimumAltitude = 0.0f;
+    InputParams.MaximumAltitude = 2000.0f;
+    InputParams.SeaLevel = 250.0f;
+
+    FParse::Value(*Params, TEXT("NorthLat="), InputParams.NorthernLatitude);
+    FParse::Value(*Params, TEXT("SouthLat="), InputParams.SouthernLatitude);
+    FParse::Value(*Params, TEXT("CentralLon="), InputParams.CentralLongitude);
+    FParse::Value(*Params, TEXT("MinAlt="), InputParams.MinimumAltitude);
+    FParse::Value(*Params, TEXT("MaxAlt="), InputParams.MaximumAltitude);
+    FParse::Value(*Params, TEXT("SeaLevel="), InputParams.SeaLevel);
+
+    return InputParams;
+}
+
+int32 UBiomeGenerationCommandlet::Main(const FString& Params)
+{
+    FString HeightmapPath;
+    FString BatchSource;
+    const bool bSingle = FParse::Value(*Params, TEXT("Heightmap="), HeightmapPath);
+    const bool bBatch = FParse::Value(*Params, TEXT("Batch="), BatchSource);
+
+    if (bSingle == bBatch)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Usage: -run=BiomeGeneration (-Heightmap=<path> | -Batch=<dir or manifest>) [-Output=<dir>] [-NorthLat= -SouthLat= -CentralLon= -MinAlt= -MaxAlt= -SeaLevel=] [-YearLength= -DayLength= -DayOfYear=] [-Tiled [-TileSize= -HaloSize=]] [-MemoryBudgetMB=] [-Jobs=] [-CSV | -Columnar] [-Columns=] [-LookupTable [-ValidateLookupTable]] [-ExactMath] [-NoISPC]"));
+        return 1;
+    }
+
+    if (bSingle && !FPaths::FileExists(HeightmapPath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Heightmap not found: %s"), *HeightmapPath);
+        return 1;
+    }
+
+    FString OutputDirectory;
+    if (!FParse::Value(*Params, TEXT("Output="), OutputDirectory))
+    {
+        OutputDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BiomeMapper"));
+        if (bSingle)
+        {
+            OutputDirectory = FPaths::Combine(OutputDirectory, FPaths::GetBaseFilename(HeightmapPath));
+        }
+    }
+
+    FBiomeSimulationContext Context;
+    Context.InputParams = ParseInputParameters(Params);
+
+    // Planet time, with the editor's defaults
+    float YearLength = 365.25f;
+    float DayLength = 24.0f;
+    int32 DayOfYear = 0;
+    FParse::Value(*Params, TEXT("YearLength="), YearLength);
+    FParse::Value(*Params, TEXT("DayLength="), DayLength);
+    FParse::Value(*Params, TEXT("DayOfYear="), DayOfYear);
+    Context.PlanetTime = FPlanetTime(YearLength, DayLength, 0.0f, DayOfYear, 0.0f);
+
+    // Reference results for checking the fast climate math against
+    if (FParse::Param(*Params, TEXT("ExactMath")))
+    {
+        Context.MathMode = EClimateMathMode::Exact;
+        UE_LOG(LogTemp, Display, TEXT("Climate math mode: %s"), ClimateMath::GetModeName(Context.MathMode));
+    }
+
+    if (FParse::Param(*Params, TEXT("NoISPC")))
+    {
+        BiomeISPC::SetEnabled(false);
+    }
+
+    // Compiled classification, optionally checked cell by cell against the exact path
+    FBiomeLookupTableSettings LookupTableSettings;
+    LookupTableSettings.bEnabled = FParse::Param(*Params, TEXT("LookupTable"));
+    LookupTableSettings.bValidate = LookupTableSettings.bEnabled && FParse::Param(*Params, TEXT("ValidateLookupTable"));
+
+    int32 MemoryBudgetMB = 0;
+    FParse::Value(*Params, TEXT("MemoryBudgetMB="), MemoryBudgetMB);
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    if (bSingle && FParse::Param(*Params, TEXT("Tiled")))
+    {
+        if (!FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*OutputDirectory))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create output directory: %s"), *OutputDirectory);
+            return 1;
+        }
+
+        FTiledPipelineSettings Settings;
+        Settings.OutputDirectory = OutputDirectory;
+        Settings.LookupTable = LookupTableSettings;
+        if (MemoryBudgetMB > 0)
+        {
+            Settings.MemoryBudgetBytes = static_cast<int64>(MemoryBudgetMB) * 1024 * 1024;
+        }
+        FParse::Value(*Params, TEXT("TileSize="), Settings.TileSize);
+        FParse::Value(*Params, TEXT("HaloSize="), Settings.HaloSize);
+
+        UE_LOG(LogTemp, Display, TEXT("Generating biomes for %s into %s"), *HeightmapPath, *OutputDirectory);
+
+        FString Summary;
+        if (!FTiledBiomePipeline::Run(HeightmapPath, Context, Settings, Summary))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Biome generation failed for %s"), *HeightmapPath);
+            return 1;
+        }
+
+        FFileHelper::SaveStringToFile(Summary, *FPaths::Combine(OutputDirectory, TEXT("BiomeSummary.txt")));
+        UE_LOG(LogTemp, Display, TEXT("%s"), *Summary);
+        UE_LOG(LogTemp, Display, TEXT("Biome generation finished in %.1f s."), FPlatformTime::Seconds() - StartTime);
+        return 0;
+    }
+
+    // In-core runs go through the batch scheduler; a single heightmap is a batch of one
+    TArray<FBiomeBatchJob> Jobs;
+    if (bSingle)
+    {
+        FBiomeBatchJob& Job = Jobs.AddDefaulted_GetRef();
+        Job.HeightmapPath = HeightmapPath;
+        Job.OutputDirectory = OutputDirectory;
+        Job.Context = Context;
+    }
+    else if (!FBiomeBatchScheduler::CollectJobs(BatchSource, Context, OutputDirectory, Jobs))
+    {
+        return 1;
+    }
+
+    FBiomeBatchSettings Settings;
+    Settings.LookupTable = LookupTableSettings;
+    Settings.Export.bEnabled = FParse::Param(*Params, TEXT("CSV")) || FParse::Param(*Params, TEXT("Columnar"));
+    Settings.Export.Format = FParse::Param(*Params, TEXT("Columnar")) ? EBiomeDataFormat::Columnar : EBiomeDataFormat::CSV;
+
+    FString ColumnNames;
+    if (FParse::Value(*Params, TEXT("Columns="), ColumnNames, false) && !FBiomeDataExporter::ParseColumns(ColumnNames, Settings.Export.Columns))
+    {
+        return 1;
+    }
+    FParse::Value(*Params, TEXT("Jobs="), Settings.MaxConcurrentJobs);
+    if (MemoryBudgetMB > 0)
+    {
+        Settings.MemoryBudgetBytes = static_cast<int64>(MemoryBudgetMB) * 1024 * 1024;
+    }
+
+    const bool bSucceeded = FBiomeBatchScheduler::Run(Jobs, Settings);
+
+    if (bSingle && bSucceeded)
+    {
+        UE_LOG(LogTemp, Display, TEXT("%s"), *Jobs[0].Summary);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("Biome generation finished in %.1f s."), FPlatformTime::Seconds() - StartTime);
+    return bSucceeded ? 0 : 1;
+}
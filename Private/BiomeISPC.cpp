@@ -0,0 +1,14 @@
+#include "BiomeISPC.h"
+#include <atomic>
+
+static std::atomic<bool> bISPCEnabled(true);
+
+bool BiomeISPC::IsEnabled()
+{
+    return IsAvailable() && bISPCEnabled.load(std::memory_order_relaxed);
+}
+
+void BiomeISPC::SetEnabled(bool bEnabled)
+{
+    bISPCEnabled.store(bEnabled, std::memory_order_relaxed);
+}
@@ -0,0 +1,43 @@
+#include "BiomeJobProgress.h"
+
+FBiomeJobProgress::FBiomeJobProgress(int32 InNumStages)
+    : NumStages(FMath::Max(InNumStages, 1)),
+      StageIndex(-1),
+      StageWork(0),
+      StageTotal(1),
+      bCancelled(false)
+{
+}
+
+void FBiomeJobProgress::BeginStage(const FString& Name, int64 TotalWork)
+{
+    {
+        FScopeLock Lock(&StageNameLock);
+        StageName = Name;
+    }
+
+    StageTotal.store(FMath::Max<int64>(TotalWork, 1), std::memory_order_relaxed);
+    StageWork.store(0, std::memory_order_relaxed);
+    StageIndex.fetch_add(1, std::memory_order_relaxed);
+
+    UE_LOG(LogTemp, Log, TEXT("Biome job: %s"), *Name);
+}
+
+float FBiomeJobProgress::GetStageFraction() const
+{
+    const double Work = static_cast<double>(StageWork.load(std::memory_order_relaxed));
+    const double Total = static_cast<double>(StageTotal.load(std::memory_order_relaxed));
+    return static_cast<float>(FMath::Clamp(Work / Total, 0.0, 1.0));
+}
+
+float FBiomeJobProgress::GetOverallFraction() const
+{
+    const int32 Completed = FMath::Max(StageIndex.load(std::memory_order_relaxed), 0);
+    return FMath::Clamp((Completed + GetStageFraction()) / NumStages, 0.0f, 1.0f);
+}
+
+FString FBiomeJobProgress::GetStageText() const
+{
+    FScopeLock Lock(&StageNameLock);
+    return FString::Printf(TEXT("%s (%d/%d)"), *StageName, FMath::Clamp(StageIndex.load(std::memory_order_relaxed) + 1, 1, NumStages), NumStages);
+}
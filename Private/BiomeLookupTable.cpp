@@ -0,0 +1,154 @@
+#include "BiomeLookupTable.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "Async/ParallelFor.h"
+#include "BiomeCalculator.h"
+#include "BiomeWeightedProbability.h"
+#include <cmath>
+
+void FBiomeLookupTable::FAxis::Build(float Min, float Max, float Step, const TArray<float>& Thresholds)
+{
+    Step = FMath::Max(Step, UE_KINDA_SMALL_NUMBER);
+    Max = FMath::Max(Max, Min);
+
+    Edges.Reset();
+    const int32 NumSteps = FMath::Max(FMath::CeilToInt((Max - Min) / Step), 1);
+    for (int32 StepIndex = 0; StepIndex < NumSteps; ++StepIndex)
+    {
+        Edges.Add(Min + StepIndex * Step);
+    }
+
+    // Split at each threshold and just above it, so both ">=" and ">" comparisons change only at an edge
+    float MinThreshold = TNumericLimits<float>::Max();
+    for (float Threshold : Thresholds)
+    {
+        Edges.Add(Threshold);
+        Edges.Add(std::nextafter(Threshold, TNumericLimits<float>::Max()));
+        MinThreshold = FMath::Min(MinThreshold, Threshold);
+    }
+
+    // Values below the first edge land in the first bin, which must lie below every threshold
+    if (MinThreshold <= Min)
+    {
+        Edges.Add(MinThreshold - Step);
+    }
+
+    Edges.Sort();
+    Edges.SetNum(Algo::Unique(Edges));
+
+    Centers.SetNumUninitialized(Edges.Num());
+    for (int32 Bin = 0; Bin < Edges.Num() - 1; ++Bin)
+    {
+        // A bin one ulp wide holds only its lower edge, and its midpoint can round up onto the next edge
+        const float Center = 0.5f * (Edges[Bin] + Edges[Bin + 1]);
+        Centers[Bin] = Center < Edges[Bin + 1] ? Center : Edges[Bin];
+    }
+    Centers.Last() = Edges.Last() < Max ? 0.5f * (Edges.Last() + Max) : Edges.Last();
+}
+
+int32 FBiomeLookupTable::FAxis::FindBin(float Value) const
+{
+    return FMath::Max(Algo::UpperBound(Edges, Value) - 1, 0);
+}
+
+bool FBiomeLookupTable::Build(const FBiomeLookupTableSettings& Settings, const FInputParameters& InputParams)
+{
+    TArray<float> TemperatureThresholds;
+    TArray<float> PrecipitationThresholds;
+    TArray<float> LatitudeThresholds;
+    TArray<float> AltitudeThresholds;
+    UBiomeCalculator::GetCandidateThresholds(TemperatureThresholds, PrecipitationThresholds, LatitudeThresholds, AltitudeThresholds);
+
+    // The rules and weights only depend on the latitude's magnitude
+    const float SouthernMagnitude = FMath::Abs(InputParams.SouthernLatitude);
+    const float NorthernMagnitude = FMath::Abs(InputParams.NorthernLatitude);
+    const bool bCrossesEquator = InputParams.SouthernLatitude <= 0.0f && InputParams.NorthernLatitude >= 0.0f;
+    const float MinLatitude = bCrossesEquator ? 0.0f : FMath::Min(SouthernMagnitude, NorthernMagnitude);
+    const float MaxLatitude = FMath::Max(SouthernMagnitude, NorthernMagnitude);
+
+    TemperatureAxis.Build(Settings.TemperatureRange.X, Settings.TemperatureRange.Y, Settings.TemperatureStep, TemperatureThresholds);
+    PrecipitationAxis.Build(Settings.PrecipitationRange.X, Settings.PrecipitationRange.Y, Settings.PrecipitationStep, PrecipitationThresholds);
+    LatitudeAxis.Build(MinLatitude, MaxLatitude, Settings.LatitudeStep, LatitudeThresholds);
+    AltitudeAxis.Build(InputParams.MinimumAltitude, InputParams.MaximumAltitude, Settings.AltitudeStep, AltitudeThresholds);
+    SlopeAxis.Build(0.0f, 90.0f, Settings.SlopeStep, TArray<float>());
+    AspectAxis.Build(0.0f, 360.0f, Settings.AspectStep, TArray<float>());
+
+    const int64 NumEntries = static_cast<int64>(TemperatureAxis.Num()) * PrecipitationAxis.Num() * LatitudeAxis.Num() *
+                             AltitudeAxis.Num() * SlopeAxis.Num() * AspectAxis.Num();
+
+    if (NumEntries > FMath::Min<int64>(Settings.MaxEntries, MAX_int32))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Biome lookup table would need %lld entries; using exact classification."), NumEntries);
+        Empty();
+        return false;
+    }
+
+    Entries.SetNumUninitialized(NumEntries);
+
+    const int32 NumTerrainBins = SlopeAxis.Num() * AspectAxis.Num();
+    const int32 NumClimateBins = Entries.Num() / NumTerrainBins;
+
+    // Each climate bin has one candidate set, scored for every slope and aspect bin
+    ParallelFor(NumClimateBins, [&](int32 ClimateBin)
+    {
+        int32 Remaining = ClimateBin;
+        const float Altitude = AltitudeAxis.Centers[Remaining % AltitudeAxis.Num()];
+        Remaining /= AltitudeAxis.Num();
+        const float Latitude = LatitudeAxis.Centers[Remaining % LatitudeAxis.Num()];
+        Remaining /= LatitudeAxis.Num();
+        const float Precipitation = PrecipitationAxis.Centers[Remaining % PrecipitationAxis.Num()];
+        Remaining /= PrecipitationAxis.Num();
+        const float Temperature = TemperatureAxis.Centers[Remaining];
+
+        const FBiomeCandidateMask Candidates = UBiomeCalculator::FilterBiomeCandidateMask(Temperature, Precipitation, Latitude, Altitude);
+        EBiomeId* BinEntries = Entries.GetData() + ClimateBin * NumTerrainBins;
+
+        for (int32 SlopeBin = 0; SlopeBin < SlopeAxis.Num(); ++SlopeBin)
+        {
+            for (int32 AspectBin = 0; AspectBin < AspectAxis.Num(); ++AspectBin)
+            {
+                BinEntries[SlopeBin * AspectAxis.Num() + AspectBin] = Candidates != 0
+                    ? CalculateBiomeProbabilities(Temperature, Precipitation, Latitude, Altitude,
+                        SlopeAxis.Centers[SlopeBin], AspectAxis.Centers[AspectBin], Candidates)
+                    : EBiomeId::Unknown;
+            }
+        }
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("Built biome lookup table: %d x %d x %d x %d x %d x %d bins, %lld bytes."),
+        TemperatureAxis.Num(), PrecipitationAxis.Num(), LatitudeAxis.Num(), AltitudeAxis.Num(),
+        SlopeAxis.Num(), AspectAxis.Num(), static_cast<int64>(GetAllocatedSize()));
+
+    return true;
+}
+
+void FBiomeLookupTable::Empty()
+{
+    for (FAxis* Axis : { &TemperatureAxis, &PrecipitationAxis, &LatitudeAxis, &AltitudeAxis, &SlopeAxis, &AspectAxis })
+    {
+        Axis->Edges.Empty();
+        Axis->Centers.Empty();
+    }
+    Entries.Empty();
+}
+
+EBiomeId FBiomeLookupTable::Classify(float Temperature, float AnnualPrecipitation, float Latitude, float Altitude, float Slope, float Aspect) const
+{
+    int32 Index = TemperatureAxis.FindBin(Temperature);
+    Index = Index * PrecipitationAxis.Num() + PrecipitationAxis.FindBin(AnnualPrecipitation);
+    Index = Index * LatitudeAxis.Num() + LatitudeAxis.FindBin(FMath::Abs(Latitude));
+    Index = Index * AltitudeAxis.Num() + AltitudeAxis.FindBin(Altitude);
+    Index = Index * SlopeAxis.Num() + SlopeAxis.FindBin(Slope);
+    Index = Index * AspectAxis.Num() + AspectAxis.FindBin(Aspect);
+    return Entries[Index];
+}
+
+SIZE_T FBiomeLookupTable::GetAllocatedSize() const
+{
+    SIZE_T Size = Entries.GetAllocatedSize();
+    for (const FAxis* Axis : { &TemperatureAxis, &PrecipitationAxis, &LatitudeAxis, &AltitudeAxis, &SlopeAxis, &AspectAxis })
+    {
+        Size += Axis->Edges.GetAllocatedSize() + Axis->Centers.GetAllocatedSize();
+    }
+    return Size;
+}
@@ -0,0 +1,55 @@
+#include "BiomeRegistry.h"
+
+// Biome names, colors and weights, in EBiomeId order
+static const FBiomeDefinition BiomeDefinitions[] = {
+    { TEXT("Ocean"), FColor::Black, { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f } },
+    { TEXT("Unknown"), FColor::Black, { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f } },
+    { TEXT("Tropical Rainforest"), FColor::FromHex("#006400"), { 3.0f, 3.5f, 3.0f, 0.5f, 0.0f, 0.0f } },
+    { TEXT("Tropical Monsoon Forests"), FColor::FromHex("#228B22"), { 3.0f, 3.2f, 3.0f, 0.5f, 0.0f, 0.0f } },
+    { TEXT("Savanna"), FColor::FromHex("#F5DEB3"), { 2.5f, 2.5f, 2.0f, 1.0f, 0.5f, 0.0f } },
+    { TEXT("Temperate Steppe and Savanna"), FColor::FromHex("#8b7d63"), { 1.8f, 1.5f, 1.5f, 1.5f, 0.8f, 0.2f } },
+    { TEXT("Temperate Broadleaf"), FColor::FromHex("#877116"), { 2.0f, 2.0f, 1.5f, 1.0f, 0.5f, 0.1f } },
+    { TEXT("Subtropical Evergreen Forest"), FColor::FromHex("#89b855"), { 2.0f, 2.0f, 1.5f, 1.0f, 0.5f, 0.1f } },
+    { TEXT("Mediterranean"), FColor::FromHex("#513058"), { 1.5f, 2.0f, 1.2f, 1.0f, 0.6f, 0.1f } },
+    { TEXT("Xeric Shrubland"), FColor::FromHex("#c4947c"), { 1.0f, 0.7f, 0.5f, 0.2f, 0.3f, 0.0f } },
+    { TEXT("Dry Forest and Woodland Savanna"), FColor::FromHex("#59463a"), { 2.0f, 2.5f, 1.8f, 1.2f, 0.5f, 0.1f } },
+    { TEXT("Hot Arid Desert"), FColor::FromHex("#782713"), { 3.0f, 0.5f, 0.2f, 0.1f, 0.1f, 0.0f } },
+    { TEXT("Tundra"), FColor::FromHex("#30abf8"), { 3.0f, 0.8f, 1.0f, 2.5f, 1.5f, 0.2f } },
+    { TEXT("Montane Forests and Grasslands"), FColor::FromHex("#077891"), { 2.5f, 2.0f, 1.0f, 3.0f, 1.0f, 0.1f } },
+    { TEXT("Taiga (Boreal Forest)"), FColor::FromHex("#084f45"), { 3.0f, 1.5f, 1.5f, 2.0f, 0.8f, 0.1f } },
+    { TEXT("Cold or Polar Desert"), FColor::FromHex("#D3D3D3"), { 1.0f, 0.5f, 0.2f, 3.0f, 1.0f, 0.0f } }
+};
+
+static_assert(UE_ARRAY_COUNT(BiomeDefinitions) == static_cast<int32>(EBiomeId::Count), "Every EBiomeId needs a definition");
+
+const FBiomeDefinition& FBiomeRegistry::Get(EBiomeId Id)
+{
+    check(static_cast<int32>(Id) < Num());
+    return BiomeDefinitions[static_cast<int32>(Id)];
+}
+
+EBiomeId FBiomeRegistry::FindByName(const FString& Name)
+{
+    for (int32 Index = 0; Index < Num(); ++Index)
+    {
+        if (BiomeDefinitions[Index].Name == Name)
+        {
+            return static_cast<EBiomeId>(Index);
+        }
+    }
+    return EBiomeId::Unknown;
+}
+
+const TArray<FColor>& FBiomeRegistry::GetPalette()
+{
+    static const TArray<FColor> Palette = []()
+    {
+        TArray<FColor> Colors;
+        for (const FBiomeDefinition& Definition : BiomeDefinitions)
+        {
+            Colors.Add(Definition.Color);
+        }
+        return Colors;
+    }();
+    return Palette;
+}
@@ -0,0 +1,90 @@
+#include "BiomeStatistics.h"
+
+void FBiomeStatistics::Reset()
+{
+    FMemory::Memzero(Counts);
+    FMemory::Memzero(Area);
+    FMemory::Memzero(BandCounts);
+    FMemory::Memzero(BandArea);
+}
+
+void FBiomeStatistics::Merge(const FBiomeStatistics& Other)
+{
+    for (int32 BiomeIndex = 0; BiomeIndex < FBiomeRegistry::Num(); ++BiomeIndex)
+    {
+        Counts[BiomeIndex] += Other.Counts[BiomeIndex];
+        Area[BiomeIndex] += Other.Area[BiomeIndex];
+    }
+
+    for (int32 Band = 0; Band < NumLatitudeBands; ++Band)
+    {
+        for (int32 BiomeIndex = 0; BiomeIndex < FBiomeRegistry::Num(); ++BiomeIndex)
+        {
+            BandCounts[Band][BiomeIndex] += Other.BandCounts[Band][BiomeIndex];
+            BandArea[Band][BiomeIndex] += Other.BandArea[Band][BiomeIndex];
+        }
+    }
+}
+
+int64 FBiomeStatistics::GetTotalCount() const
+{
+    int64 Total = 0;
+    for (int64 Count : Counts)
+    {
+        Total += Count;
+    }
+    return Total;
+}
+
+double FBiomeStatistics::GetTotalArea() const
+{
+    double Total = 0.0;
+    for (double BiomeArea : Area)
+    {
+        Total += BiomeArea;
+    }
+    return Total;
+}
+
+double FBiomeStatistics::GetCoverage(EBiomeId Biome) const
+{
+    const double TotalArea = GetTotalArea();
+    return TotalArea > 0.0 ? Area[static_cast<int32>(Biome)] / TotalArea : 0.0;
+}
+
+int32 FBiomeStatistics::GetLatitudeBand(float Latitude)
+{
+    return FMath::Clamp(FMath::FloorToInt((Latitude + 90.0f) / LatitudeBandDegrees), 0, NumLatitudeBands - 1);
+}
+
+double FBiomeStatistics::GetAreaWeight(float Latitude)
+{
+    return FMath::Max(FMath::Cos(FMath::DegreesToRadians(static_cast<double>(Latitude))), 0.0);
+}
+
+FString FBiomeStatistics::FormatLatitudeBandsCSV() const
+{
+    FString CSV = "BandMin,BandMax,Biome,Cells,BandCoverage\n";
+
+    for (int32 Band = 0; Band < NumLatitudeBands; ++Band)
+    {
+        double TotalBandArea = 0.0;
+        for (double BiomeArea : BandArea[Band])
+        {
+            TotalBandArea += BiomeArea;
+        }
+
+        for (int32 BiomeIndex = 0; BiomeIndex < FBiomeRegistry::Num(); ++BiomeIndex)
+        {
+            if (BandCounts[Band][BiomeIndex] > 0)
+            {
+                CSV += FString::Printf(TEXT("%d,%d,%s,%lld,%.4f\n"),
+                    GetLatitudeBandMin(Band), GetLatitudeBandMin(Band) + LatitudeBandDegrees,
+                    *FBiomeRegistry::GetName(static_cast<EBiomeId>(BiomeIndex)), BandCounts[Band][BiomeIndex],
+                    TotalBandArea > 0.0 ? BandArea[Band][BiomeIndex] / TotalBandArea : 0.0);
+            }
+        }
+    }
+
+    return CSV;
+}
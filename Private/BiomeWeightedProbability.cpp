@@ -1,86 +1,147 @@
 #include "BiomeWeightedProbability.h"
-#include "Async/ParallelFor.h"
-
-// Define BiomeWeightMap
-TMap<FString, FBiomeWeights> BiomeWeightMap = {
-    { "Tropical Rainforest", { 3.0f, 3.5f, 3.0f, 0.5f, 0.0f, 0.0f } },
-    { "Savanna", { 2.5f, 2.5f, 2.0f, 1.0f, 0.5f, 0.0f } },
-    { "Tropical Monsoon Forests", { 3.0f, 3.2f, 3.0f, 0.5f, 0.0f, 0.0f } },
-    { "Temperate Steppe and Savanna", { 1.8f, 1.5f, 1.5f, 1.5f, 0.8f, 0.2f } },
-    { "Temperate Broadleaf", { 2.0f, 2.0f, 1.5f, 1.0f, 0.5f, 0.1f } },
-    { "Subtropical Evergreen Forest", { 2.0f, 2.0f,  1.5f, 1.0f, 0.5f, 0.1f } },
-    { "Mediterranean", { 1.5f, 2.0f, 1.2f, 1.0f, 0.6f, 0.1f } },
-    { "Xeric Shrubland", { 1.0f, 0.7f, 0.5f, 0.2f, 0.3f, 0.0f } },
-    { "Dry Forest and Woodland Savanna", { 2.0f, 2.5f, 1.8f, 1.2f, 0.5f, 0.1f } },
-    { "Hot Arid Desert", { 3.0f, 0.5f, 0.2f, 0.1f, 0.1f, 0.0f } },
-    { "Tundra", { 3.0f, 0.8f, 1.0f, 2.5f, 1.5f, 0.2f } },
-    { "Montane Forests and Grasslands", { 2.5f, 2.0f, 1.0f, 3.0f, 1.0f, 0.1f } },
-    { "Taiga (Boreal Forest)", { 3.0f, 1.5f, 1.5f, 2.0f, 0.8f, 0.1f } },
-    { "Cold or Polar Desert", { 1.0f, 0.5f, 0.2f, 3.0f, 1.0f, 0.0f } }
-};
-
-
-FString CalculateBiomeProbabilities(
+#include "BiomeISPC.h"
+
+#if INTEL_ISPC
+#include "BiomeWeightedProbability.ispc.generated.h"
+#endif
+
+EBiomeId CalculateBiomeProbabilities(
     float AdjustedTemperature, float Precipitation,
     float Latitude, float Altitude, float Slope, float Aspect,
-    TArray<FString> Candidates)
+    FBiomeCandidateMask Candidates)
 {
-    TArray<TPair<FString, float>> Probabilities;
-    Probabilities.Reserve(Candidates.Num());
-
-    // Temporary array to hold scores
-    TArray<float> Scores;
-    Scores.SetNumZeroed(Candidates.Num());
+    // The highest score is also the highest probability, so the total is not needed.
+    // Candidates are visited in ID order, which keeps the first-added candidate on ties.
+    EBiomeId BestBiome = EBiomeId::Unknown;
+    float MaxScore = 0.0f;
 
-    // Parallel calculation of scores
-    ParallelFor(Candidates.Num(), [&](int32 Index)
+    while (Candidates != 0)
     {
-        const FString& Candidate = Candidates[Index];
-        const FBiomeWeights* WeightsPtr = BiomeWeightMap.Find(Candidate);
-
-        if (!WeightsPtr)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Biome '%s' not found in BiomeWeightMap. Skipping."), *Candidate);
-            Scores[Index] = 0.0f;
-            return;
-        }
+        const EBiomeId Candidate = static_cast<EBiomeId>(FMath::CountTrailingZeros(Candidates));
+        Candidates &= Candidates - 1;
 
-        const FBiomeWeights& Weights = *WeightsPtr;
+        const FBiomeWeights& Weights = FBiomeRegistry::GetWeights(Candidate);
 
         // Calculate the score for the biome
-        Scores[Index] = FMath::Max(0.0f, 
+        const float Score = FMath::Max(0.0f,
             Weights.TempWeight * AdjustedTemperature +
-            Weights.PrecWeight * Precipitation +           
+            Weights.PrecWeight * Precipitation +
             Weights.LatitudeWeight * FMath::Abs(Latitude) +
             Weights.AltitudeWeight * Altitude +
             Weights.SlopeWeight * Slope +
             Weights.AspectWeight * Aspect);
-    });
-
-    float TotalScore = 0.0f;
 
-    for (float Score : Scores)
-    {
-        TotalScore += Score;
+        if (Score > MaxScore)
+        {
+            MaxScore = Score;
+            BestBiome = Candidate;
+        }
     }
 
-    FString BestBiome = "Unknown Biome";
-    float MaxProbability = 0.0f;
+    return BestBiome;
+}
 
-    for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+namespace
+{
+    /** Registry weights as a dense matrix, one row per input so each row is read contiguously. */
+    struct FBiomeWeightMatrix
     {
-        if (Scores[Index] > 0.0f)
+        float Temp[FBiomeRegistry::Num()];
+        float Prec[FBiomeRegistry::Num()];
+        float Latitude[FBiomeRegistry::Num()];
+        float Altitude[FBiomeRegistry::Num()];
+        float Slope[FBiomeRegistry::Num()];
+        float Aspect[FBiomeRegistry::Num()];
+
+        FBiomeWeightMatrix()
         {
-            float Probability = Scores[Index] / TotalScore;
-            if (Probability > MaxProbability)
+            for (int32 Biome = 0; Biome < FBiomeRegistry::Num(); ++Biome)
             {
-                MaxProbability = Probability;
-                BestBiome = Candidates[Index];
+                const FBiomeWeights& Weights = FBiomeRegistry::GetWeights(static_cast<EBiomeId>(Biome));
+                Temp[Biome] = Weights.TempWeight;
+                Prec[Biome] = Weights.PrecWeight;
+                Latitude[Biome] = Weights.LatitudeWeight;
+                Altitude[Biome] = Weights.AltitudeWeight;
+                Slope[Biome] = Weights.SlopeWeight;
+                Aspect[Biome] = Weights.AspectWeight;
             }
         }
+    };
+
+    const FBiomeWeightMatrix& GetWeightMatrix()
+    {
+        static const FBiomeWeightMatrix Matrix;
+        return Matrix;
     }
+}
 
-    return BestBiome;
+void CalculateBiomeProbabilitiesBatch(const FBiomeScoreBatch& Batch, int32 Num, EBiomeId* OutBiomes, EClimateMathMode MathMode)
+{
+    check(Num >= 0 && Num <= BIOME_SCORE_BATCH_SIZE);
+
+    const FBiomeWeightMatrix& Matrix = GetWeightMatrix();
+
+#if INTEL_ISPC
+    // ISPC contracts and reorders the weighted sums, so exact runs stay on the C++ path
+    if (BiomeISPC::IsEnabled() && MathMode == EClimateMathMode::Fast)
+    {
+        static_assert(sizeof(EBiomeId) == sizeof(uint8) && sizeof(FBiomeCandidateMask) == sizeof(uint32), "The ISPC kernel reads these as uint8 and uint32");
+        ispc::ScoreBiomeBatch(
+            Batch.Temperature, Batch.Precipitation, Batch.Latitude, Batch.Altitude, Batch.Slope, Batch.Aspect, Batch.Candidates, Num,
+            Matrix.Temp, Matrix.Prec, Matrix.Latitude, Matrix.Altitude, Matrix.Slope, Matrix.Aspect, FBiomeRegistry::Num(),
+            static_cast<uint8>(EBiomeId::Unknown), reinterpret_cast<uint8*>(OutBiomes));
+        return;
+    }
+#endif
+
+    float LatitudeMagnitude[BIOME_SCORE_BATCH_SIZE];
+    float MaxScore[BIOME_SCORE_BATCH_SIZE];
+    uint8 BestBiome[BIOME_SCORE_BATCH_SIZE];
+    FBiomeCandidateMask AnyCandidates = 0;
+
+    for (int32 Cell = 0; Cell < Num; ++Cell)
+    {
+        LatitudeMagnitude[Cell] = FMath::Abs(Batch.Latitude[Cell]);
+        MaxScore[Cell] = 0.0f;
+        BestBiome[Cell] = static_cast<uint8>(EBiomeId::Unknown);
+        AnyCandidates |= Batch.Candidates[Cell];
+    }
+
+    // Biomes in the outer loop keep the per-cell loop branch-free, so it vectorizes.
+    // Visiting biomes in ID order with a strict comparison keeps the same tie-break as the per-cell path.
+    while (AnyCandidates != 0)
+    {
+        const uint32 Biome = FMath::CountTrailingZeros(AnyCandidates);
+        AnyCandidates &= AnyCandidates - 1;
+
+        const float TempWeight = Matrix.Temp[Biome];
+        const float PrecWeight = Matrix.Prec[Biome];
+        const float LatitudeWeight = Matrix.Latitude[Biome];
+        const float AltitudeWeight = Matrix.Altitude[Biome];
+        const float SlopeWeight = Matrix.Slope[Biome];
+        const float AspectWeight = Matrix.Aspect[Biome];
+        const FBiomeCandidateMask Bit = FBiomeCandidateMask(1) << Biome;
+
+        for (int32 Cell = 0; Cell < Num; ++Cell)
+        {
+            const float Score =
+                TempWeight * Batch.Temperature[Cell] +
+                PrecWeight * Batch.Precipitation[Cell] +
+                LatitudeWeight * LatitudeMagnitude[Cell] +
+                AltitudeWeight * Batch.Altitude[Cell] +
+                SlopeWeight * Batch.Slope[Cell] +
+                AspectWeight * Batch.Aspect[Cell];
+
+            const bool bBetter = (Batch.Candidates[Cell] & Bit) != 0 && Score > MaxScore[Cell];
+            MaxScore[Cell] = bBetter ? Score : MaxScore[Cell];
+            BestBiome[Cell] = bBetter ? static_cast<uint8>(Biome) : BestBiome[Cell];
+        }
+    }
+
+    for (int32 Cell = 0; Cell < Num; ++Cell)
+    {
+        OutBiomes[Cell] = static_cast<EBiomeId>(BestBiome[Cell]);
+    }
 }
 
 /*
@@ -0,0 +1,117 @@
+#include "ClimateGrid.h"
+
+void FClimateGrid::Init(int32 InWidth, int32 InHeight)
+{
+    Width = InWidth;
+    Height = InHeight;
+
+    const int32 NumCells = Num();
+    const FHeightmapCell Defaults;
+
+    RowLatitude.Init(0.0f, Height);
+    ColumnLongitude.Init(0.0f, Width);
+    Resolution = FVector2D::ZeroVector;
+
+    CellType.Init(Defaults.CellType, NumCells);
+    Altitude.Init(Defaults.Altitude, NumCells);
+    OceanDepth.Init(Defaults.OceanDepth, NumCells);
+    DistanceToOcean.Init(Defaults.DistanceToOcean, NumCells);
+    OceanToLandVector.Init(FVector2f::ZeroVector, NumCells);
+    WindDirection.Init(FVector2f::ZeroVector, NumCells);
+    IsWindOnshore.Init(Defaults.IsWindOnshore, NumCells);
+    Slope.Init(Defaults.Slope, NumCells);
+    Aspect.Init(Defaults.Aspect, NumCells);
+    Curvature.Init(0.0f, NumCells);
+    Roughness.Init(0.0f, NumCells);
+    Temperature.Init(Defaults.Temperature, NumCells);
+    AnnualPrecipitation.Init(Defaults.AnnualPrecipitation, NumCells);
+    Albedo.Init(Defaults.Albedo, NumCells);
+    ClosestOceanTemperature.Init(Defaults.ClosestOceanTemperature, NumCells);
+    ClosestOceanCurrentType.Init(EOceanCurrentType::Warm, NumCells);
+    FlowDirection.Init(EOceanFlowDirection::Clockwise, NumCells);
+    BiomeId.Init(EBiomeId::Ocean, NumCells);
+
+    // The planes were reset, the cached fields have to be copied in again
+    OceanProximity.bAppliedToGrid = false;
+}
+
+void FClimateGrid::Empty()
+{
+    Width = 0;
+    Height = 0;
+
+    RowLatitude.Empty();
+    ColumnLongitude.Empty();
+    Resolution = FVector2D::ZeroVector;
+    CellType.Empty();
+    Altitude.Empty();
+    OceanDepth.Empty();
+    DistanceToOcean.Empty();
+    OceanToLandVector.Empty();
+    WindDirection.Empty();
+    IsWindOnshore.Empty();
+    Slope.Empty();
+    Aspect.Empty();
+    Curvature.Empty();
+    Roughness.Empty();
+    Temperature.Empty();
+    AnnualPrecipitation.Empty();
+    Albedo.Empty();
+    ClosestOceanTemperature.Empty();
+    ClosestOceanCurrentType.Empty();
+    FlowDirection.Empty();
+    BiomeId.Empty();
+
+    OceanProximity.bAppliedToGrid = false;
+}
+
+FHeightmapCell FClimateGrid::GetCell(int32 Index) const
+{
+    FHeightmapCell Cell;
+    Cell.Albedo = Albedo[Index];
+    Cell.Altitude = Altitude[Index];
+    Cell.AnnualPrecipitation = AnnualPrecipitation[Index];
+    Cell.Aspect = Aspect[Index];
+    Cell.BiomeType = FBiomeRegistry::GetName(BiomeId[Index]);
+    Cell.BiomeColor = FBiomeRegistry::GetColor(BiomeId[Index]);
+    Cell.CellType = CellType[Index];
+    Cell.ClosestOceanTemperature = ClosestOceanTemperature[Index];
+    Cell.ClosestOceanCurrentType = OceanCurrents::ToString(ClosestOceanCurrentType[Index]);
+    Cell.DistanceToOcean = DistanceToOcean[Index];
+    Cell.FlowDirection = OceanCurrents::ToString(FlowDirection[Index]);
+    Cell.IsWindOnshore = IsWindOnshore[Index];
+    Cell.Latitude = GetLatitude(Index);
+    Cell.Longitude = GetLongitude(Index);
+    Cell.OceanDepth = OceanDepth[Index];
+    Cell.OceanToLandVector = FVector2D(OceanToLandVector[Index]);
+    Cell.Slope = Slope[Index];
+    Cell.Temperature = Temperature[Index];
+    Cell.WindDirection = FVector2D(WindDirection[Index]);
+    return Cell;
+}
+
+SIZE_T FClimateGrid::GetAllocatedSize() const
+{
+    return RowLatitude.GetAllocatedSize() + ColumnLongitude.GetAllocatedSize() +
+        CellType.GetAllocatedSize() + Altitude.GetAllocatedSize() + OceanDepth.GetAllocatedSize() +
+        DistanceToOcean.GetAllocatedSize() + OceanToLandVector.GetAllocatedSize() + WindDirection.GetAllocatedSize() +
+        IsWindOnshore.GetAllocatedSize() + Slope.GetAllocatedSize() + Aspect.GetAllocatedSize() +
+        Curvature.GetAllocatedSize() + Roughness.GetAllocatedSize() +
+        Temperature.GetAllocatedSize() + AnnualPrecipitation.GetAllocatedSize() + Albedo.GetAllocatedSize() +
+        ClosestOceanTemperature.GetAllocatedSize() + ClosestOceanCurrentType.GetAllocatedSize() +
+        FlowDirection.GetAllocatedSize() + BiomeId.GetAllocatedSize() + OceanProximity.GetAllocatedSize();
+}
+
+SIZE_T FClimateGrid::GetBytesPerCell()
+{
+    // Every plane indexed by cell, as allocated by Init
+    return sizeof(decltype(CellType)::ElementType) + sizeof(decltype(Altitude)::ElementType) +
+        sizeof(decltype(OceanDepth)::ElementType) + sizeof(decltype(DistanceToOcean)::ElementType) +
+        sizeof(decltype(OceanToLandVector)::ElementType) + sizeof(decltype(WindDirection)::ElementType) +
+        sizeof(decltype(IsWindOnshore)::ElementType) + sizeof(decltype(Slope)::ElementType) +
+        sizeof(decltype(Aspect)::ElementType) + sizeof(decltype(Curvature)::ElementType) +
+        sizeof(decltype(Roughness)::ElementType) + sizeof(decltype(Temperature)::ElementType) +
+        sizeof(decltype(AnnualPrecipitation)::ElementType) + sizeof(decltype(Albedo)::ElementType) +
+        sizeof(decltype(ClosestOceanTemperature)::ElementType) + sizeof(decltype(ClosestOceanCurrentType)::ElementType) +
+        sizeof(decltype(FlowDirection)::ElementType) + sizeof(decltype(BiomeId)::ElementType);
+}
@@ -0,0 +1,303 @@
+#include "ClimateKernel.h"
+#include "Async/ParallelFor.h"
+#include "UnifiedWindCalculator.h"
+#include "WindUtils.h"
+#include "Precipitation.h"
+#include "Temperature.h"
+#include "OceanTemperature.h"
+#include "Albedo.h"
+#include "BiomeJobProgress.h"
+#include "BiomeISPC.h"
+
+#if INTEL_ISPC
+#include "ClimateKernel.ispc.generated.h"
+#endif
+
+// Cells per row block; with about 50 bytes of planes per cell a block stays within L2
+static constexpr int32 CLIMATE_BLOCK_CELLS = 4096;
+
+// Albedo effect on temperature (°C)
+static constexpr float ALBEDO_EFFECT = 5.0f;
+
+// Ocean temperature before the albedo cooling, the FHeightmapCell default. No stage sets the
+// temperature of ocean cells, so the cooling starts from this rather than from the previous run's result.
+static constexpr float OCEAN_BASE_TEMPERATURE = 0.0f;
+
+namespace
+{
+    void WindStage(FClimateCell& Cell, const FBiomeSimulationContext& Context)
+    {
+        Cell.WindDirection = Cell.Row->WindDirection[Cell.Hemisphere];
+        Cell.bIsWindOnshore = WindUtils::IsOnshoreWind(Cell.WindDirection, Cell.OceanToLandVector);
+    }
+
+    void SurfaceTemperatureStage(FClimateCell& Cell, const FBiomeSimulationContext& Context)
+    {
+        if (!Cell.bIsOcean)
+        {
+            Cell.Temperature = Temperature::CalculateSurfaceTemperatureFromInsolation(
+                Cell.Row->SolarInsolation, Cell.Altitude, Cell.Slope, Cell.Aspect, Cell.WindDirection.Size());
+        }
+    }
+
+    void OceanModerationStage(FClimateCell& Cell, const FBiomeSimulationContext& Context)
+    {
+        if (!Cell.bIsOcean)
+        {
+            Cell.Temperature = OceanTemperature::ApplyWaterEffect(
+                Cell.Temperature, Cell.DistanceToOcean, Cell.Row->OceanWaterEffect[Cell.Hemisphere]);
+        }
+    }
+
+    void PrecipitationStage(FClimateCell& Cell, const FBiomeSimulationContext& Context)
+    {
+        if (!Cell.bIsOcean)
+        {
+            Cell.Precipitation = Precipitation::CalculatePrecipitationFromFactors(
+                Cell.Row->PrecipitationLatitudeFactor, Cell.PrecipitationOceanFactor, Cell.Altitude, Cell.Slope, Cell.WindDirection, Cell.OceanToLandVector);
+        }
+    }
+
+    void WeatherAdjustmentStage(FClimateCell& Cell, const FBiomeSimulationContext& Context)
+    {
+        if (!Cell.bIsOcean)
+        {
+            WindUtils::AdjustWeatherFactors(
+                Cell.bIsWindOnshore, Cell.WindDirection.Size(), Cell.Precipitation, Cell.Temperature, Cell.DistanceToOcean);
+        }
+    }
+
+    void AlbedoStage(FClimateCell& Cell, const FBiomeSimulationContext& Context)
+    {
+        Cell.Albedo = Albedo::CalculateCellAlbedo(Cell.Albedo, Cell.Row->BaseAlbedo, Cell.DistanceToOcean, Cell.Temperature, Cell.Precipitation);
+    }
+
+    void AlbedoTemperatureStage(FClimateCell& Cell, const FBiomeSimulationContext& Context)
+    {
+        const float BaseTemperature = Cell.bIsOcean ? OCEAN_BASE_TEMPERATURE : Cell.Temperature;
+        Cell.Temperature = BaseTemperature - Cell.Albedo * ALBEDO_EFFECT;
+    }
+
+#if INTEL_ISPC
+    static_assert(sizeof(FVector2f) == 2 * sizeof(float), "The ISPC kernel reads vector planes as interleaved floats");
+    static_assert(sizeof(bool) == sizeof(int8) && sizeof(ECellType) == sizeof(uint8), "The ISPC kernel reads these planes as bytes");
+
+    // Every default stage for one row, in ISPC
+    void RunDefaultStagesISPC(FClimateGrid& Grid, const FClimateRow& Row, int32 Y)
+    {
+        ispc::FClimateRowTerms Terms;
+        for (int32 Hemisphere = 0; Hemisphere < 2; ++Hemisphere)
+        {
+            Terms.WindX[Hemisphere] = static_cast<float>(Row.WindDirection[Hemisphere].X);
+            Terms.WindY[Hemisphere] = static_cast<float>(Row.WindDirection[Hemisphere].Y);
+            Terms.OceanWaterEffect[Hemisphere] = Row.OceanWaterEffect[Hemisphere];
+        }
+        Terms.SolarInsolation = Row.SolarInsolation;
+        Terms.PrecipitationLatitudeFactor = Row.PrecipitationLatitudeFactor;
+        Terms.BaseAlbedo = Row.BaseAlbedo;
+
+        const int32 RowStart = Y * Grid.Width;
+        ispc::RunDefaultClimateRow(
+            Grid.Width,
+            &Terms,
+            Grid.ColumnLongitude.GetData(),
+            reinterpret_cast<const uint8*>(&Grid.CellType[RowStart]),
+            static_cast<uint8>(ECellType::Ocean),
+            &Grid.Altitude[RowStart],
+            &Grid.DistanceToOcean[RowStart],
+            &Grid.Slope[RowStart],
+            &Grid.Aspect[RowStart],
+            reinterpret_cast<const float*>(&Grid.OceanToLandVector[RowStart]),
+            reinterpret_cast<float*>(&Grid.WindDirection[RowStart]),
+            reinterpret_cast<int8*>(&Grid.IsWindOnshore[RowStart]),
+            &Grid.Temperature[RowStart],
+            &Grid.AnnualPrecipitation[RowStart],
+            &Grid.Albedo[RowStart]);
+    }
+#endif
+}
+
+FClimateKernel::FClimateKernel()
+{
+    for (int32 Stage = 0; Stage < static_cast<int32>(EClimateStage::Num); ++Stage)
+    {
+        Stages[Stage] = GetDefaultStage(static_cast<EClimateStage>(Stage));
+        bStageEnabled[Stage] = true;
+    }
+}
+
+const FClimateKernel& FClimateKernel::GetDefault()
+{
+    static const FClimateKernel DefaultKernel;
+    return DefaultKernel;
+}
+
+FClimateStageFunction FClimateKernel::GetDefaultStage(EClimateStage Stage)
+{
+    switch (Stage)
+    {
+    case EClimateStage::Wind:               return &WindStage;
+    case EClimateStage::SurfaceTemperature: return &SurfaceTemperatureStage;
+    case EClimateStage::OceanModeration:    return &OceanModerationStage;
+    case EClimateStage::Precipitation:      return &PrecipitationStage;
+    case EClimateStage::WeatherAdjustment:  return &WeatherAdjustmentStage;
+    case EClimateStage::Albedo:             return &AlbedoStage;
+    case EClimateStage::AlbedoTemperature:  return &AlbedoTemperatureStage;
+    default:                                return nullptr;
+    }
+}
+
+void FClimateKernel::SetStage(EClimateStage Stage, FClimateStageFunction Function)
+{
+    Stages[static_cast<int32>(Stage)] = Function;
+}
+
+void FClimateKernel::SetStageEnabled(EClimateStage Stage, bool bEnabled)
+{
+    bStageEnabled[static_cast<int32>(Stage)] = bEnabled;
+}
+
+bool FClimateKernel::IsStageEnabled(EClimateStage Stage) const
+{
+    return bStageEnabled[static_cast<int32>(Stage)] && Stages[static_cast<int32>(Stage)] != nullptr;
+}
+
+bool FClimateKernel::IsDefault() const
+{
+    for (int32 Stage = 0; Stage < static_cast<int32>(EClimateStage::Num); ++Stage)
+    {
+        if (!bStageEnabled[Stage] || Stages[Stage] != GetDefaultStage(static_cast<EClimateStage>(Stage)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FClimateKernel::BuildRowTable(const FClimateGrid& Grid, TArray<FClimateRow>& OutRows)
+{
+    // Representative longitudes of the western and eastern hemispheres; only their sign is used
+    const float HemisphereLongitude[2] = { -1.0f, 0.0f };
+
+    OutRows.SetNum(Grid.Height);
+    ParallelFor(Grid.Height, [&](int32 Y)
+    {
+        const float Latitude = Grid.RowLatitude[Y];
+        FClimateRow& Row = OutRows[Y];
+
+        for (int32 Hemisphere = 0; Hemisphere < 2; ++Hemisphere)
+        {
+            Row.WindDirection[Hemisphere] = UnifiedWindCalculator::CalculateRefinedWind(Latitude, HemisphereLongitude[Hemisphere], 0.0f);
+            Row.OceanWaterEffect[Hemisphere] = OceanTemperature::CalculateWaterEffect(Latitude, HemisphereLongitude[Hemisphere]);
+        }
+
+        Row.SolarInsolation = Temperature::CalculateSolarInsolation(Latitude);
+        Row.PrecipitationLatitudeFactor = Precipitation::CalculateLatitudeFactor(Latitude);
+        Row.BaseAlbedo = Albedo::CalculateAlbedo(Latitude);
+    });
+}
+
+bool FClimateKernel::Run(FClimateGrid& Grid, const FBiomeSimulationContext& Context, FBiomeJobProgress* Progress) const
+{
+    TArray<FClimateRow> Rows;
+    BuildRowTable(Grid, Rows);
+
+    // Resolve the enabled stages once rather than per cell
+    TArray<FClimateStageFunction, TInlineAllocator<static_cast<int32>(EClimateStage::Num)>> ActiveStages;
+    for (int32 Stage = 0; Stage < static_cast<int32>(EClimateStage::Num); ++Stage)
+    {
+        if (IsStageEnabled(static_cast<EClimateStage>(Stage)))
+        {
+            ActiveStages.Add(Stages[Stage]);
+        }
+    }
+
+    const int32 RowsPerBlock = FMath::Max(CLIMATE_BLOCK_CELLS / FMath::Max(Grid.Width, 1), 1);
+    const int32 NumBlocks = FMath::DivideAndRoundUp(Grid.Height, RowsPerBlock);
+
+#if INTEL_ISPC
+    // The ISPC kernel hard-codes the default stages and uses the ISPC standard library's exponential
+    const bool bUseISPC = BiomeISPC::IsEnabled() && Context.MathMode == EClimateMathMode::Fast && IsDefault();
+#endif
+
+    ParallelFor(NumBlocks, [&](int32 Block)
+    {
+        if (IsJobCancelled(Progress))
+        {
+            return;
+        }
+
+        const int32 FirstRow = Block * RowsPerBlock;
+        const int32 LastRow = FMath::Min(FirstRow + RowsPerBlock, Grid.Height);
+
+#if INTEL_ISPC
+        if (bUseISPC)
+        {
+            for (int32 Y = FirstRow; Y < LastRow; ++Y)
+            {
+                RunDefaultStagesISPC(Grid, Rows[Y], Y);
+            }
+
+            if (Progress)
+            {
+                Progress->AddWork(LastRow - FirstRow);
+            }
+            return;
+        }
+#endif
+
+        TArray<float> OceanFactors;
+        OceanFactors.SetNumUninitialized(Grid.Width);
+
+        for (int32 Y = FirstRow; Y < LastRow; ++Y)
+        {
+            const float Latitude = Grid.RowLatitude[Y];
+            const FClimateRow& Row = Rows[Y];
+            const int32 RowStart = Y * Grid.Width;
+
+            Precipitation::CalculateOceanFactors(&Grid.DistanceToOcean[RowStart], OceanFactors.GetData(), Grid.Width, Context.MathMode);
+
+            for (int32 X = 0; X < Grid.Width; ++X)
+            {
+                const int32 i = RowStart + X;
+
+                FClimateCell Cell;
+                Cell.Latitude = Latitude;
+                Cell.Longitude = Grid.ColumnLongitude[X];
+                Cell.Altitude = Grid.Altitude[i];
+                Cell.DistanceToOcean = Grid.DistanceToOcean[i];
+                Cell.Slope = Grid.Slope[i];
+                Cell.Aspect = Grid.Aspect[i];
+                Cell.OceanToLandVector = FVector2D(Grid.OceanToLandVector[i]);
+                Cell.FlowDirection = Grid.FlowDirection[i];
+                Cell.bIsOcean = Grid.CellType[i] == ECellType::Ocean;
+                Cell.Row = &Row;
+                Cell.Hemisphere = Cell.Longitude >= 0.0f ? 1 : 0;
+                Cell.PrecipitationOceanFactor = OceanFactors[X];
+                Cell.WindDirection = FVector2D(Grid.WindDirection[i]);
+                Cell.bIsWindOnshore = Grid.IsWindOnshore[i];
+                Cell.Temperature = Grid.Temperature[i];
+                Cell.Precipitation = Grid.AnnualPrecipitation[i];
+                Cell.Albedo = Grid.Albedo[i];
+
+                for (const FClimateStageFunction Stage : ActiveStages)
+                {
+                    Stage(Cell, Context);
+                }
+
+                Grid.WindDirection[i] = FVector2f(Cell.WindDirection);
+                Grid.IsWindOnshore[i] = Cell.bIsWindOnshore;
+                Grid.Temperature[i] = Cell.Temperature;
+                Grid.AnnualPrecipitation[i] = Cell.Precipitation;
+                Grid.Albedo[i] = Cell.Albedo;
+            }
+        }
+
+        if (Progress)
+        {
+            Progress->AddWork(LastRow - FirstRow);
+        }
+    });
+
+    return !IsJobCancelled(Progress);
+}
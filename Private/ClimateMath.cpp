@@ -0,0 +1,203 @@
+#include "ClimateMath.h"
+#include "Math/UnrealMathUtility.h"
+
+// Polynomial coefficients and range reductions follow the single-precision Cephes library
+
+namespace
+{
+    constexpr float CLIMATE_PI = 3.1415926535897932f;
+    constexpr float CLIMATE_HALF_PI = 1.5707963267948966f;
+    constexpr float CLIMATE_QUARTER_PI = 0.78539816339744831f;
+
+    FORCEINLINE float BitsToFloat(uint32 Bits)
+    {
+        float Value;
+        FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+        return Value;
+    }
+
+    FORCEINLINE uint32 FloatToBits(float Value)
+    {
+        uint32 Bits;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        return Bits;
+    }
+
+    FORCEINLINE float Select(bool bCondition, float IfTrue, float IfFalse)
+    {
+        return bCondition ? IfTrue : IfFalse;
+    }
+
+    // Polynomial on [0, tan(pi/8)]; shared by Atan and Atan2
+    FORCEINLINE float AtanPoly(float X)
+    {
+        const float Z = X * X;
+        return (((8.05374449538e-2f * Z - 1.38776856032e-1f) * Z + 1.99777106478e-1f) * Z - 3.33329491539e-1f) * Z * X + X;
+    }
+
+    FORCEINLINE float ExpLane(float X)
+    {
+        // 2^N must stay a normal float
+        X = Select(X < -87.3f, -87.3f, Select(X > 88.3f, 88.3f, X));
+
+        // X = N ln2 + R with |R| <= ln2 / 2; ln2 split in two so N ln2 is exact
+        const float Scaled = X * 1.44269504089f;
+        const int32 N = static_cast<int32>(Scaled + Select(Scaled < 0.0f, -0.5f, 0.5f));
+        const float FloatN = static_cast<float>(N);
+        const float R = (X - FloatN * 0.693359375f) + FloatN * 2.12194440e-4f;
+
+        const float P = 1.0f + R * (1.0f + R * (0.5f + R * (1.66666667e-1f + R * (4.16666667e-2f
+                      + R * (8.33333333e-3f + R * (1.38888889e-3f + R * 1.98412698e-4f))))));
+        return P * BitsToFloat(static_cast<uint32>(N + 127) << 23);
+    }
+
+    FORCEINLINE float LogLane(float X)
+    {
+        // X = M 2^E with M in [sqrt(1/2), sqrt(2))
+        const uint32 Bits = FloatToBits(X);
+        int32 E = static_cast<int32>((Bits >> 23) & 0xff) - 126;
+        float M = BitsToFloat((Bits & 0x007fffffu) | 0x3f000000u);
+        const bool bSmall = M < 0.707106781186547524f;
+        E -= bSmall ? 1 : 0;
+        M = Select(bSmall, M + M, M) - 1.0f;
+
+        const float Z = M * M;
+        float Y = ((((((((7.0376836292e-2f * M - 1.1514610310e-1f) * M + 1.1676998740e-1f) * M - 1.2420140846e-1f) * M
+                  + 1.4249322787e-1f) * M - 1.6668057665e-1f) * M + 2.0000714765e-1f) * M - 2.4999993993e-1f) * M
+                  + 3.3333331174e-1f) * M * Z;
+        const float FloatE = static_cast<float>(E);
+        Y += -2.12194440e-4f * FloatE;
+        Y += -0.5f * Z;
+        return M + Y + 0.693359375f * FloatE;
+    }
+
+    FORCEINLINE float AtanLane(float X)
+    {
+        const float AbsX = FMath::Abs(X);
+
+        // Reduce to [0, tan(pi/8)] with atan(x) = pi/2 - atan(1/x) and atan(x) = pi/4 + atan((x-1)/(x+1))
+        const bool bLarge = AbsX > 2.414213562373095f;
+        const bool bMiddle = AbsX > 0.4142135623730950f;
+        const float Numerator = Select(bLarge, -1.0f, Select(bMiddle, AbsX - 1.0f, AbsX));
+        const float Denominator = Select(bLarge, AbsX, Select(bMiddle, AbsX + 1.0f, 1.0f));
+        const float Offset = Select(bLarge, CLIMATE_HALF_PI, Select(bMiddle, CLIMATE_QUARTER_PI, 0.0f));
+
+        const float Result = Offset + AtanPoly(Numerator / Denominator);
+        return Select(X < 0.0f, -Result, Result);
+    }
+
+    FORCEINLINE float Atan2Lane(float Y, float X)
+    {
+        // Same quadrant handling as FMath::Atan2, including 0 for (0, 0)
+        const float AbsX = FMath::Abs(X);
+        const float AbsY = FMath::Abs(Y);
+        const bool bYAbsBigger = AbsY > AbsX;
+        const float Max = Select(bYAbsBigger, AbsY, AbsX);
+        const float Min = Select(bYAbsBigger, AbsX, AbsY);
+        const float Ratio = Min / Select(Max > 0.0f, Max, 1.0f);
+
+        const bool bMiddle = Ratio > 0.4142135623730950f;
+        float Result = Select(bMiddle, CLIMATE_QUARTER_PI, 0.0f)
+                     + AtanPoly(Select(bMiddle, (Ratio - 1.0f) / (Ratio + 1.0f), Ratio));
+        Result = Select(bYAbsBigger, CLIMATE_HALF_PI - Result, Result);
+        Result = Select(X < 0.0f, CLIMATE_PI - Result, Result);
+        return Select(Y < 0.0f, -Result, Result);
+    }
+
+    FORCEINLINE float CosLane(float X)
+    {
+        // Reduce by multiples of pi/4 to [-pi/4, pi/4], with pi/4 split in three so J pi/4 is exact
+        const float AbsX = FMath::Abs(X);
+        int32 J = static_cast<int32>(AbsX * 1.27323954473516f);
+        J += J & 1;
+        const float FloatJ = static_cast<float>(J);
+        const float R = ((AbsX - FloatJ * 0.78515625f) - FloatJ * 2.4187564849853515625e-4f) - FloatJ * 3.77489497744594108e-8f;
+        const float Z = R * R;
+
+        const float SinPoly = ((-1.9515295891e-4f * Z + 8.3321608736e-3f) * Z - 1.6666654611e-1f) * Z * R + R;
+        const float CosPoly = ((2.443315711809948e-5f * Z - 1.388731625493765e-3f) * Z + 4.166664568298827e-2f) * Z * Z - 0.5f * Z + 1.0f;
+
+        // Octant J of [0, 2pi): 0 and 4 use cos, 2 and 6 use sin; 2 and 4 are negated
+        const int32 Octant = J & 7;
+        const float Result = Select((Octant & 2) != 0, SinPoly, CosPoly);
+        return Select(Octant == 2 || Octant == 4, -Result, Result);
+    }
+
+    // Runs a lane function on every element, in blocks of LaneCount and then the remainder
+    template <typename FLaneFunction>
+    FORCEINLINE void ForEachElement(int32 Num, FLaneFunction&& LaneFunction)
+    {
+        int32 Index = 0;
+        for (; Index + ClimateMath::LaneCount <= Num; Index += ClimateMath::LaneCount)
+        {
+            for (int32 Lane = 0; Lane < ClimateMath::LaneCount; ++Lane)
+            {
+                LaneFunction(Index + Lane);
+            }
+        }
+        for (; Index < Num; ++Index)
+        {
+            LaneFunction(Index);
+        }
+    }
+}
+
+void ClimateMath::Exp(const float* X, float* Out, int32 Num, EClimateMathMode Mode)
+{
+    if (Mode == EClimateMathMode::Exact)
+    {
+        ForEachElement(Num, [&](int32 i) { Out[i] = FMath::Exp(X[i]); });
+        return;
+    }
+    ForEachElement(Num, [&](int32 i) { Out[i] = ExpLane(X[i]); });
+}
+
+void ClimateMath::Atan(const float* X, float* Out, int32 Num, EClimateMathMode Mode)
+{
+    if (Mode == EClimateMathMode::Exact)
+    {
+        ForEachElement(Num, [&](int32 i) { Out[i] = FMath::Atan(X[i]); });
+        return;
+    }
+    ForEachElement(Num, [&](int32 i) { Out[i] = AtanLane(X[i]); });
+}
+
+void ClimateMath::Atan2(const float* Y, const float* X, float* Out, int32 Num, EClimateMathMode Mode)
+{
+    if (Mode == EClimateMathMode::Exact)
+    {
+        ForEachElement(Num, [&](int32 i) { Out[i] = FMath::Atan2(Y[i], X[i]); });
+        return;
+    }
+    ForEachElement(Num, [&](int32 i) { Out[i] = Atan2Lane(Y[i], X[i]); });
+}
+
+void ClimateMath::Cos(const float* X, float* Out, int32 Num, EClimateMathMode Mode)
+{
+    if (Mode == EClimateMathMode::Exact)
+    {
+        ForEachElement(Num, [&](int32 i) { Out[i] = FMath::Cos(X[i]); });
+        return;
+    }
+    ForEachElement(Num, [&](int32 i) { Out[i] = CosLane(X[i]); });
+}
+
+void ClimateMath::Pow(const float* Base, float Exponent, float* Out, int32 Num, EClimateMathMode Mode)
+{
+    if (Mode == EClimateMathMode::Exact)
+    {
+        ForEachElement(Num, [&](int32 i) { Out[i] = Base[i] > 0.0f ? FMath::Pow(Base[i], Exponent) : 0.0f; });
+        return;
+    }
+    ForEachElement(Num, [&](int32 i)
+    {
+        // The logarithm of a non-positive base is garbage, but the select discards it
+        const float Value = Base[i];
+        Out[i] = Select(Value > 0.0f, ExpLane(Exponent * LogLane(Value)), 0.0f);
+    });
+}
+
+const TCHAR* ClimateMath::GetModeName(EClimateMathMode Mode)
+{
+    return Mode == EClimateMathMode::Exact ? TEXT("exact") : TEXT("fast");
+}
@@ -1,124 +1,504 @@
 #include "DistanceToOcean.h"
 #include "Math/UnrealMathUtility.h"
 #include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "OceanCurrents.h"
+#include "OceanTemperature.h"
+
+// Columns per task of the streamed column pass
+static constexpr int32 COLUMN_BLOCK = 1024;
+
+namespace
+{
+    /** Per-worker scratch for one row of the distance transform. */
+    struct FRowEnvelope
+    {
+        /** Nearest ocean row within each column of the row, -1 if none. */
+        TArray<int32> ColumnOceanRow;
+
+        /** Columns whose parabolas form the lower envelope, left to right. */
+        TArray<int32> Sites;
+
+        /** Column at which each envelope parabola starts to be the lowest. */
+        TArray<double> Bounds;
+    };
+
+    /** Euclidean distance between two cells, in cells. */
+    float GetCellDistance(int32 X, int32 Y, int32 OceanX, int32 OceanY)
+    {
+        const double DeltaX = X - OceanX;
+        const double DeltaY = OceanY - Y;
+        return static_cast<float>(FMath::Sqrt(DeltaX * DeltaX + DeltaY * DeltaY));
+    }
+
+    /**
+     * Row pass of the transform for row Y. The squared distance along a row is the lower envelope
+     * of one parabola per column, (X - Column)^2 + ColumnDistance^2 (Felzenszwalb and Huttenlocher).
+     * @param ColumnOceanRow - Nearest ocean row within each column of the row, -1 if none; may be overwritten by CellFunction.
+     * @param CellFunction - Called as CellFunction(X, OceanX, OceanY) with the nearest ocean cell of each column.
+     * @return False if no column has ocean, in which case CellFunction is not called.
+     */
+    template <typename FCellFunction>
+    bool SolveRowEnvelope(FRowEnvelope& Envelope, const int32* ColumnOceanRow, int32 Width, int32 Y, FCellFunction&& CellFunction)
+    {
+        Envelope.ColumnOceanRow.SetNumUninitialized(Width);
+        Envelope.Sites.SetNumUninitialized(Width);
+        Envelope.Bounds.SetNumUninitialized(Width + 1);
+        FMemory::Memcpy(Envelope.ColumnOceanRow.GetData(), ColumnOceanRow, Width * sizeof(int32));
+
+        // Height of a column's parabola at X = 0
+        const auto SiteOffset = [&](int32 Column)
+        {
+            const double Rows = Envelope.ColumnOceanRow[Column] - Y;
+            return Rows * Rows + static_cast<double>(Column) * Column;
+        };
+
+        int32 NumSites = 0;
+        for (int32 Column = 0; Column < Width; ++Column)
+        {
+            if (Envelope.ColumnOceanRow[Column] == -1)
+            {
+                continue;
+            }
+
+            // Drop parabolas the new one hides entirely
+            double Bound = -DBL_MAX;
+            while (NumSites > 0)
+            {
+                const int32 Site = Envelope.Sites[NumSites - 1];
+                Bound = (SiteOffset(Column) - SiteOffset(Site)) / (2.0 * (Column - Site));
+                if (Bound > Envelope.Bounds[NumSites - 1])
+                {
+                    break;
+                }
+                NumSites--;
+                Bound = -DBL_MAX;
+            }
+
+            Envelope.Sites[NumSites] = Column;
+            Envelope.Bounds[NumSites] = Bound;
+            NumSites++;
+        }
+
+        if (NumSites == 0)
+        {
+            return false;
+        }
+
+        Envelope.Bounds[NumSites] = DBL_MAX;
+
+        int32 Segment = 0;
+        for (int32 X = 0; X < Width; ++X)
+        {
+            while (Envelope.Bounds[Segment + 1] < X)
+            {
+                Segment++;
+            }
+
+            const int32 Site = Envelope.Sites[Segment];
+            CellFunction(X, Site, Envelope.ColumnOceanRow[Site]);
+        }
+        return true;
+    }
+
+    /** Normalized vector from a cell's nearest ocean cell to the cell, zero if it has none. */
+    FVector2f GetOceanToLandVector(const FClimateGrid& Grid, int32 Index, int32 OceanIndex)
+    {
+        if (OceanIndex == -1) // Ensure there's a valid nearest ocean cell
+        {
+            return FVector2f::ZeroVector;
+        }
+
+        return FVector2f(
+            Grid.GetLongitude(Index) - Grid.GetLongitude(OceanIndex),
+            Grid.GetLatitude(Index) - Grid.GetLatitude(OceanIndex)
+        ).GetSafeNormal();
+    }
+
+    /**
+     * Key of the grid's current ocean mask and geolocation. The mask is hashed row by row,
+     * 64 cells to a word, without materializing it.
+     */
+    FOceanProximityKey MakeOceanProximityKey(const FClimateGrid& Grid)
+    {
+        const int32 WordsPerRow = FMath::DivideAndRoundUp(Grid.Width, 64);
+
+        TArray<uint64> RowHashes;
+        RowHashes.SetNumUninitialized(Grid.Height);
+
+        TArray<TArray<uint64>> RowWords;
+        ParallelForWithTaskContext(RowWords, Grid.Height, [&](TArray<uint64>& Words, int32 Y)
+        {
+            Words.Reset();
+            Words.AddZeroed(WordsPerRow);
+
+            const float* RowOceanDepth = Grid.OceanDepth.GetData() + Y * Grid.Width;
+            for (int32 X = 0; X < Grid.Width; ++X)
+            {
+                Words[X / 64] |= static_cast<uint64>(RowOceanDepth[X] > 0.0f) << (X % 64);
+            }
+            RowHashes[Y] = CityHash64(reinterpret_cast<const char*>(Words.GetData()), WordsPerRow * sizeof(uint64));
+        });
+
+        FOceanProximityKey Key;
+        Key.Width = Grid.Width;
+        Key.Height = Grid.Height;
+        Key.OceanMaskHash = CityHash64(reinterpret_cast<const char*>(RowHashes.GetData()), Grid.Height * sizeof(uint64));
+        Key.LatitudeExtent = FVector2f(Grid.RowLatitude[0], Grid.RowLatitude.Last());
+        Key.LongitudeExtent = FVector2f(Grid.ColumnLongitude[0], Grid.ColumnLongitude.Last());
+        return Key;
+    }
+
+    /**
+     * Copies the ocean temperature, current type and flow direction of each cell's
+     * nearest ocean cell, once the nearest ocean cell is known.
+     */
+    void PropagateOceanAttributes(FClimateGrid& Grid, const TArray<int32>& ClosestOceanIndex)
+    {
+        ParallelFor(Grid.Num(), [&](int32 Index)
+        {
+            const int32 OceanIndex = ClosestOceanIndex[Index];
+            if (OceanIndex != -1 && OceanIndex != Index)
+            {
+                Grid.ClosestOceanTemperature[Index] = Grid.ClosestOceanTemperature[OceanIndex];
+                Grid.ClosestOceanCurrentType[Index] = Grid.ClosestOceanCurrentType[OceanIndex];
+                Grid.FlowDirection[Index] = Grid.FlowDirection[OceanIndex];
+            }
+        });
+    }
+}
 
 bool FindClosestOceanCell(
-    TArray<FHeightmapCell>& Data,
-    int32 Width,
-    int32 Height,
+    FClimateGrid& Grid,
     TArray<float>& OutDistanceMap,
     TArray<int32>& OutClosestOceanIndex)
 {
-    if (Data.Num() != Width * Height)
+    const int32 Width = Grid.Width;
+    const int32 Height = Grid.Height;
+
+    if (Grid.Num() <= 0 || Grid.OceanDepth.Num() != Grid.Num())
     {
         UE_LOG(LogTemp, Error, TEXT("Invalid data dimensions for closest ocean cell calculation."));
         return false;
     }
 
-    // Initialize distance map and closest ocean index map
-    OutDistanceMap.Init(FLT_MAX, Data.Num());
-    OutClosestOceanIndex.Init(-1, Data.Num());
-
-    TQueue<int32> Queue;
+    OutDistanceMap.SetNumUninitialized(Grid.Num());
+    OutClosestOceanIndex.SetNumUninitialized(Grid.Num());
 
-    // Enqueue all ocean cells
-    ParallelFor(Data.Num(), [&](int32 Index)
+    // Column pass: nearest ocean row within each column, -1 if the column has none.
+    // OutClosestOceanIndex holds the row until the row pass replaces it with the cell index.
+    ParallelFor(Width, [&](int32 X)
     {
-        if (Data[Index].OceanDepth > 0.0f) // Ocean cell
+        int32 OceanRow = -1;
+        for (int32 Y = 0; Y < Height; ++Y)
         {
-            OutDistanceMap[Index] = 0.0f;
-            OutClosestOceanIndex[Index] = Index; // The cell itself is the closest ocean cell
-            Queue.Enqueue(Index);
+            const int32 Index = Y * Width + X;
+            if (Grid.OceanDepth[Index] > 0.0f) // Ocean cell
+            {
+                OceanRow = Y;
+            }
+            OutClosestOceanIndex[Index] = OceanRow;
         }
-    });
 
-    // Neighbor offsets
-    const TArray<FIntPoint> Offsets = { FIntPoint(0, 1), FIntPoint(0, -1), FIntPoint(1, 0), FIntPoint(-1, 0) };
+        OceanRow = -1;
+        for (int32 Y = Height - 1; Y >= 0; --Y)
+        {
+            const int32 Index = Y * Width + X;
+            const int32 AboveRow = OutClosestOceanIndex[Index];
+            if (AboveRow == Y)
+            {
+                OceanRow = Y;
+            }
+            else if (OceanRow != -1 && (AboveRow == -1 || OceanRow - Y < Y - AboveRow))
+            {
+                OutClosestOceanIndex[Index] = OceanRow;
+            }
+        }
+    });
 
-    // BFS for distance calculation
-    while (!Queue.IsEmpty())
+    // Row pass, see SolveRowEnvelope
+    TArray<FRowEnvelope> Envelopes;
+    ParallelForWithTaskContext(Envelopes, Height, [&](FRowEnvelope& Envelope, int32 Y)
     {
-        int32 CurrentIndex;
-        Queue.Dequeue(CurrentIndex);
-
-        int32 CurrentX = CurrentIndex % Width;
-        int32 CurrentY = CurrentIndex / Width;
-        float CurrentDistance = OutDistanceMap[CurrentIndex];
-        int32 ClosestOceanIndex = OutClosestOceanIndex[CurrentIndex];
+        const int32 RowStart = Y * Width;
+        const bool bHasOcean = SolveRowEnvelope(Envelope, OutClosestOceanIndex.GetData() + RowStart, Width, Y,
+            [&](int32 X, int32 OceanX, int32 OceanY)
+            {
+                OutDistanceMap[RowStart + X] = GetCellDistance(X, Y, OceanX, OceanY);
+                OutClosestOceanIndex[RowStart + X] = OceanY * Width + OceanX;
+            });
 
-        for (const FIntPoint& Offset : Offsets)
+        if (!bHasOcean)
         {
-            int32 NeighborX = CurrentX + Offset.X;
-            int32 NeighborY = CurrentY + Offset.Y;
-
-            if (NeighborX >= 0 && NeighborX < Width && NeighborY >= 0 && NeighborY < Height)
+            // No ocean anywhere in the grid
+            for (int32 X = 0; X < Width; ++X)
             {
-                int32 NeighborIndex = NeighborY * Width + NeighborX;
+                OutDistanceMap[RowStart + X] = FLT_MAX;
+                OutClosestOceanIndex[RowStart + X] = -1;
+            }
+        }
+    });
 
-                if (OutDistanceMap[NeighborIndex] > CurrentDistance + 1.0f) // Update distance
-                {
-                    OutDistanceMap[NeighborIndex] = CurrentDistance + 1.0f;
-                    OutClosestOceanIndex[NeighborIndex] = ClosestOceanIndex;
+    PropagateOceanAttributes(Grid, OutClosestOceanIndex);
+
+    return true;
+}
 
-                    // Propagate ocean temperature to land cells
-                    Data[NeighborIndex].ClosestOceanTemperature = Data[ClosestOceanIndex].ClosestOceanTemperature;
+bool CalculateDistanceToOcean(FClimateGrid& Grid)
+{
+    FOceanProximityCache& Cache = Grid.OceanProximity;
 
-                    // Propagate ocean current type to land cells
-                    Data[NeighborIndex].ClosestOceanCurrentType = Data[ClosestOceanIndex].ClosestOceanCurrentType;
+    if (Grid.Num() <= 0 || Grid.OceanDepth.Num() != Grid.Num())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid data dimensions for closest ocean cell calculation."));
+        return false;
+    }
 
-                    //Propagate ocean current flow direction
-                    Data[NeighborIndex].FlowDirection = Data[ClosestOceanIndex].FlowDirection;
+    // The cached index is only valid for the ocean mask it was computed from
+    const FOceanProximityKey Key = MakeOceanProximityKey(Grid);
 
-                    Queue.Enqueue(NeighborIndex);
-                }
+    if (Cache.Matches(Key))
+    {
+        if (Cache.bAppliedToGrid)
+        {
+            return true;
+        }
+
+        // The grid was re-initialized; derive its planes from the cached index again
+        ParallelFor(Grid.Height, [&](int32 Y)
+        {
+            for (int32 X = 0; X < Grid.Width; ++X)
+            {
+                const int32 Index = Y * Grid.Width + X;
+                const int32 OceanIndex = Cache.ClosestOceanIndex[Index];
+                Grid.DistanceToOcean[Index] = (OceanIndex != -1)
+                    ? GetCellDistance(X, Y, OceanIndex % Grid.Width, OceanIndex / Grid.Width)
+                    : FLT_MAX;
+                Grid.OceanToLandVector[Index] = GetOceanToLandVector(Grid, Index, OceanIndex);
             }
+        });
+
+        PropagateOceanAttributes(Grid, Cache.ClosestOceanIndex);
+    }
+    else
+    {
+        // Find the closest ocean cells, writing the distances straight into the grid
+        if (!FindClosestOceanCell(Grid, Grid.DistanceToOcean, Cache.ClosestOceanIndex))
+        {
+            Cache.Empty();
+            return false;
         }
+
+        ParallelFor(Grid.Num(), [&](int32 Index)
+        {
+            Grid.OceanToLandVector[Index] = GetOceanToLandVector(Grid, Index, Cache.ClosestOceanIndex[Index]);
+        });
+
+        Cache.Key = Key;
     }
 
+    Cache.bAppliedToGrid = true;
     return true;
 }
 
-bool CalculateDistanceToOcean(TArray<FHeightmapCell>& Data, int32 Width, int32 Height)
+bool FindClosestOceanCellsToFile(
+    int32 Width,
+    int32 Height,
+    int64 MaxStripCells,
+    TFunctionRef<void(int32, int32, uint8*)> ReadOceanMask,
+    const FString& ScratchFilePath,
+    const FString& OutFilePath)
 {
-    if (Data.Num() != Width * Height)
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    TUniquePtr<IFileHandle> Scratch(PlatformFile.OpenWrite(*ScratchFilePath, false, true));
+    TUniquePtr<IFileHandle> Output(PlatformFile.OpenWrite(*OutFilePath));
+    if (!Scratch.IsValid() || !Output.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("Invalid data dimensions for distance calculation."));
+        UE_LOG(LogTemp, Error, TEXT("Failed to open the ocean distance files: %s, %s"), *ScratchFilePath, *OutFilePath);
         return false;
     }
 
-    TArray<float> DistanceMap;
-    TArray<int32> ClosestOceanIndex;
+    // Strips hold a mask, a column pass and a result row per cell, and must stay within int32 indexing
+    const int64 MaxCells = FMath::Min<int64>(MaxStripCells, MAX_int32 / sizeof(FIntPoint));
+    const int32 StripRows = static_cast<int32>(FMath::Clamp<int64>(MaxCells / Width, 1, Height));
+    const int32 NumStrips = FMath::DivideAndRoundUp(Height, StripRows);
+    const int32 NumColumnBlocks = FMath::DivideAndRoundUp(Width, COLUMN_BLOCK);
+    const int64 ColumnRowBytes = static_cast<int64>(Width) * sizeof(int32);
+
+    TArray<uint8> OceanMask;
+    TArray<int32> ColumnOceanRows;
+    TArray<FIntPoint> ClosestOceanCells;
+    OceanMask.SetNumUninitialized(StripRows * Width);
+    ColumnOceanRows.SetNumUninitialized(StripRows * Width);
+    ClosestOceanCells.SetNumUninitialized(StripRows * Width);
+
+    // Nearest ocean row found so far in each column, carried from strip to strip
+    TArray<int32> CarriedOceanRow;
+    CarriedOceanRow.Init(-1, Width);
 
-    // Find the closest ocean cells
-    if (!FindClosestOceanCell(Data, Width, Height, DistanceMap, ClosestOceanIndex))
+    const auto ForEachColumnBlock = [&](TFunctionRef<void(int32, int32)> BlockFunction)
     {
-        return false;
+        ParallelFor(NumColumnBlocks, [&](int32 Block)
+        {
+            BlockFunction(Block * COLUMN_BLOCK, FMath::Min((Block + 1) * COLUMN_BLOCK, Width));
+        });
+    };
+
+    bool bSucceeded = true;
+
+    // Column pass, top to bottom: nearest ocean row at or above each cell, spilled to the scratch file
+    for (int32 Strip = 0; Strip < NumStrips && bSucceeded; ++Strip)
+    {
+        const int32 FirstRow = Strip * StripRows;
+        const int32 NumRows = FMath::Min(StripRows, Height - FirstRow);
+        ReadOceanMask(FirstRow, NumRows, OceanMask.GetData());
+
+        ForEachColumnBlock([&](int32 FirstColumn, int32 LastColumn)
+        {
+            for (int32 Row = 0; Row < NumRows; ++Row)
+            {
+                for (int32 X = FirstColumn; X < LastColumn; ++X)
+                {
+                    const int32 Index = Row * Width + X;
+                    if (OceanMask[Index])
+                    {
+                        CarriedOceanRow[X] = FirstRow + Row;
+                    }
+                    ColumnOceanRows[Index] = CarriedOceanRow[X];
+                }
+            }
+        });
+
+        bSucceeded = Scratch->Write(reinterpret_cast<const uint8*>(ColumnOceanRows.GetData()), NumRows * ColumnRowBytes);
     }
 
-    // Assign distances and calculate OceanToLandVector
-    ParallelFor(Data.Num(), [&](int32 Index)
+    // Column pass, bottom to top: take the nearest ocean row below where it is closer
+    CarriedOceanRow.Init(-1, Width);
+    for (int32 Strip = NumStrips - 1; Strip >= 0 && bSucceeded; --Strip)
     {
-        // Assign DistanceToOcean
-        Data[Index].DistanceToOcean = DistanceMap[Index];
+        const int32 FirstRow = Strip * StripRows;
+        const int32 NumRows = FMath::Min(StripRows, Height - FirstRow);
+        uint8* StripBytes = reinterpret_cast<uint8*>(ColumnOceanRows.GetData());
 
-        // Cache longitude and latitude for efficiency
-        float CellLongitude = Data[Index].Longitude;
-        float CellLatitude = Data[Index].Latitude;
+        if (!Scratch->Seek(FirstRow * ColumnRowBytes) || !Scratch->Read(StripBytes, NumRows * ColumnRowBytes))
+        {
+            bSucceeded = false;
+            break;
+        }
 
-        // Calculate OceanToLandVector
-        if (ClosestOceanIndex[Index] != -1) // Ensure there's a valid nearest ocean cell
+        ForEachColumnBlock([&](int32 FirstColumn, int32 LastColumn)
         {
-            const FHeightmapCell& NearestOceanCell = Data[ClosestOceanIndex[Index]];
-            Data[Index].OceanToLandVector = FVector2D(
-                CellLongitude - NearestOceanCell.Longitude,
-                CellLatitude - NearestOceanCell.Latitude
-            ).GetSafeNormal();
+            for (int32 Row = NumRows - 1; Row >= 0; --Row)
+            {
+                const int32 Y = FirstRow + Row;
+                for (int32 X = FirstColumn; X < LastColumn; ++X)
+                {
+                    const int32 Index = Row * Width + X;
+                    const int32 AboveRow = ColumnOceanRows[Index];
+                    const int32 BelowRow = CarriedOceanRow[X];
+                    if (AboveRow == Y)
+                    {
+                        CarriedOceanRow[X] = Y;
+                    }
+                    else if (BelowRow != -1 && (AboveRow == -1 || BelowRow - Y < Y - AboveRow))
+                    {
+                        ColumnOceanRows[Index] = BelowRow;
+                    }
+                }
+            }
+        });
+
+        bSucceeded = Scratch->Seek(FirstRow * ColumnRowBytes) && Scratch->Write(StripBytes, NumRows * ColumnRowBytes);
+    }
+
+    // Row pass, strip by strip in row order
+    TArray<FRowEnvelope> Envelopes;
+    for (int32 Strip = 0; Strip < NumStrips && bSucceeded; ++Strip)
+    {
+        const int32 FirstRow = Strip * StripRows;
+        const int32 NumRows = FMath::Min(StripRows, Height - FirstRow);
+
+        if (!Scratch->Seek(FirstRow * ColumnRowBytes) ||
+            !Scratch->Read(reinterpret_cast<uint8*>(ColumnOceanRows.GetData()), NumRows * ColumnRowBytes))
+        {
+            bSucceeded = false;
+            break;
         }
-        else
+
+        ParallelForWithTaskContext(Envelopes, NumRows, [&](FRowEnvelope& Envelope, int32 Row)
+        {
+            FIntPoint* RowCells = ClosestOceanCells.GetData() + Row * Width;
+            const bool bHasOcean = SolveRowEnvelope(Envelope, ColumnOceanRows.GetData() + Row * Width, Width, FirstRow + Row,
+                [&](int32 X, int32 OceanX, int32 OceanY)
+                {
+                    RowCells[X] = FIntPoint(OceanX, OceanY);
+                });
+
+            if (!bHasOcean)
+            {
+                for (int32 X = 0; X < Width; ++X)
+                {
+                    RowCells[X] = FIntPoint(INDEX_NONE, INDEX_NONE);
+                }
+            }
+        });
+
+        bSucceeded = Output->Write(reinterpret_cast<const uint8*>(ClosestOceanCells.GetData()),
+                                   static_cast<int64>(NumRows) * Width * sizeof(FIntPoint));
+    }
+
+    Scratch.Reset();
+    PlatformFile.DeleteFile(*ScratchFilePath);
+
+    if (!bSucceeded)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to stream the ocean distance transform through %s"), *ScratchFilePath);
+    }
+    return bSucceeded;
+}
+
+void ApplyClosestOceanCells(
+    FClimateGrid& Grid,
+    const FIntRect& Region,
+    const FIntPoint* ClosestOceanCells,
+    const TArray<float>& FullRowLatitude,
+    const TArray<float>& FullColumnLongitude)
+{
+    ParallelFor(Grid.Height, [&](int32 Y)
+    {
+        const int32 FullY = Region.Min.Y + Y;
+        for (int32 X = 0; X < Grid.Width; ++X)
         {
-            Data[Index].OceanToLandVector = FVector2D::ZeroVector;
+            const int32 Index = Y * Grid.Width + X;
+            const int32 FullX = Region.Min.X + X;
+            const FIntPoint OceanCell = ClosestOceanCells[Index];
+
+            if (OceanCell.X == INDEX_NONE)
+            {
+                Grid.DistanceToOcean[Index] = FLT_MAX;
+                Grid.OceanToLandVector[Index] = FVector2f::ZeroVector;
+                continue;
+            }
+
+            const float OceanLatitude = FullRowLatitude[OceanCell.Y];
+            const float OceanLongitude = FullColumnLongitude[OceanCell.X];
+
+            Grid.DistanceToOcean[Index] = GetCellDistance(FullX, FullY, OceanCell.X, OceanCell.Y);
+            Grid.OceanToLandVector[Index] = FVector2f(
+                Grid.ColumnLongitude[X] - OceanLongitude,
+                Grid.RowLatitude[Y] - OceanLatitude
+            ).GetSafeNormal();
+
+            // The attributes BuildClimateGrid gives the ocean cell, which may lie outside the region
+            if (OceanCell != FIntPoint(FullX, FullY))
+            {
+                const EOceanFlowDirection Flow = OceanCurrents::GetFlowDirection(OceanLatitude, OceanLongitude);
+                const EOceanCurrentType Current = OceanCurrents::GetCurrentType(OceanLatitude, Flow);
+                Grid.ClosestOceanTemperature[Index] = OceanTemperature::CalculateSurfaceTemperature(OceanLatitude, Current);
+                Grid.ClosestOceanCurrentType[Index] = Current;
+                Grid.FlowDirection[Index] = Flow;
+            }
         }
     });
-
-    return true;
-}
\ No newline at end of file
+}
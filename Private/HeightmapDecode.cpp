@@ -0,0 +1,305 @@
+#include "HeightmapDecode.h"
+#include "Async/ParallelFor.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define HEIGHTMAP_DECODE_AVX2
+    #else
+        #define HEIGHTMAP_DECODE_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+// Samples decoded per ParallelFor task
+static constexpr int64 DECODE_CHUNK_SAMPLES = 64 * 1024;
+
+namespace
+{
+    // Divisions rather than reciprocal multiplies, so every kernel rounds the same way
+    constexpr float MAX_UINT8 = 255.0f;
+    constexpr float MAX_UINT16 = 65535.0f;
+    constexpr double MAX_UINT32 = 4294967295.0;
+
+    // Scalar kernels, used on every platform and for the tail of the vector kernels
+
+    void DecodeUInt8Scalar(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        for (int64 i = 0; i < NumSamples; ++i)
+        {
+            OutSamples[i] = Source[i] / MAX_UINT8;
+        }
+    }
+
+    void DecodeUInt16Scalar(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        for (int64 i = 0; i < NumSamples; ++i, Source += 2)
+        {
+            const uint16 Value = (Source[1] << 8) | Source[0];
+            OutSamples[i] = Value / MAX_UINT16;
+        }
+    }
+
+    void DecodeUInt16BigEndianScalar(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        for (int64 i = 0; i < NumSamples; ++i, Source += 2)
+        {
+            const uint16 Value = (Source[0] << 8) | Source[1];
+            OutSamples[i] = Value / MAX_UINT16;
+        }
+    }
+
+    void DecodeUInt32Scalar(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        for (int64 i = 0; i < NumSamples; ++i, Source += 4)
+        {
+            const uint32 Value = (uint32(Source[3]) << 24) | (Source[2] << 16) | (Source[1] << 8) | Source[0];
+            OutSamples[i] = static_cast<float>(Value / MAX_UINT32);
+        }
+    }
+
+    void DecodeFloat32Scalar(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        FMemory::Memcpy(OutSamples, Source, NumSamples * sizeof(float));
+    }
+
+    void DecodeFloat32BigEndianScalar(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        for (int64 i = 0; i < NumSamples; ++i, Source += 4)
+        {
+            const uint32 Value = (uint32(Source[0]) << 24) | (Source[1] << 16) | (Source[2] << 8) | Source[3];
+            FMemory::Memcpy(&OutSamples[i], &Value, sizeof(float));
+        }
+    }
+
+#if PLATFORM_CPU_X86_FAMILY
+
+    // SSE2 kernels; SSE2 is part of the x64 baseline, so these need no runtime check
+
+    void DecodeUInt8SSE2(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        const __m128 Scale = _mm_set1_ps(MAX_UINT8);
+        const __m128i Zero = _mm_setzero_si128();
+        int64 i = 0;
+        for (; i + 16 <= NumSamples; i += 16)
+        {
+            const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i));
+            const __m128i Low = _mm_unpacklo_epi8(Bytes, Zero);
+            const __m128i High = _mm_unpackhi_epi8(Bytes, Zero);
+            _mm_storeu_ps(OutSamples + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Low, Zero)), Scale));
+            _mm_storeu_ps(OutSamples + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Low, Zero)), Scale));
+            _mm_storeu_ps(OutSamples + i + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(High, Zero)), Scale));
+            _mm_storeu_ps(OutSamples + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(High, Zero)), Scale));
+        }
+        DecodeUInt8Scalar(Source + i, NumSamples - i, OutSamples + i);
+    }
+
+    template <bool bBigEndian>
+    void DecodeUInt16SSE2(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        const __m128 Scale = _mm_set1_ps(MAX_UINT16);
+        const __m128i Zero = _mm_setzero_si128();
+        int64 i = 0;
+        for (; i + 8 <= NumSamples; i += 8)
+        {
+            __m128i Words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 2));
+            if (bBigEndian)
+            {
+                Words = _mm_or_si128(_mm_slli_epi16(Words, 8), _mm_srli_epi16(Words, 8));
+            }
+            _mm_storeu_ps(OutSamples + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Words, Zero)), Scale));
+            _mm_storeu_ps(OutSamples + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Words, Zero)), Scale));
+        }
+        if (bBigEndian)
+        {
+            DecodeUInt16BigEndianScalar(Source + i * 2, NumSamples - i, OutSamples + i);
+        }
+        else
+        {
+            DecodeUInt16Scalar(Source + i * 2, NumSamples - i, OutSamples + i);
+        }
+    }
+
+    void DecodeFloat32BigEndianSSE2(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        int64 i = 0;
+        for (; i + 4 <= NumSamples; i += 4)
+        {
+            // Swap the bytes within each word, then the words within each dword
+            __m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 4));
+            Value = _mm_or_si128(_mm_slli_epi16(Value, 8), _mm_srli_epi16(Value, 8));
+            Value = _mm_or_si128(_mm_slli_epi32(Value, 16), _mm_srli_epi32(Value, 16));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(OutSamples + i), Value);
+        }
+        DecodeFloat32BigEndianScalar(Source + i * 4, NumSamples - i, OutSamples + i);
+    }
+
+    // AVX2 kernels, only selected when the CPU and OS support AVX2
+
+    template <bool bBigEndian>
+    HEIGHTMAP_DECODE_AVX2 void DecodeUInt16AVX2(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        const __m256 Scale = _mm256_set1_ps(MAX_UINT16);
+        const __m128i Swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+        int64 i = 0;
+        for (; i + 16 <= NumSamples; i += 16)
+        {
+            __m128i Low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 2));
+            __m128i High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 2 + 16));
+            if (bBigEndian)
+            {
+                Low = _mm_shuffle_epi8(Low, Swap);
+                High = _mm_shuffle_epi8(High, Swap);
+            }
+            _mm256_storeu_ps(OutSamples + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(Low)), Scale));
+            _mm256_storeu_ps(OutSamples + i + 8, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(High)), Scale));
+        }
+        if (bBigEndian)
+        {
+            DecodeUInt16BigEndianScalar(Source + i * 2, NumSamples - i, OutSamples + i);
+        }
+        else
+        {
+            DecodeUInt16Scalar(Source + i * 2, NumSamples - i, OutSamples + i);
+        }
+    }
+
+    HEIGHTMAP_DECODE_AVX2 void DecodeUInt8AVX2(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        const __m256 Scale = _mm256_set1_ps(MAX_UINT8);
+        int64 i = 0;
+        for (; i + 16 <= NumSamples; i += 16)
+        {
+            const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i));
+            _mm256_storeu_ps(OutSamples + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(Bytes)), Scale));
+            _mm256_storeu_ps(OutSamples + i + 8, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(Bytes, 8))), Scale));
+        }
+        DecodeUInt8Scalar(Source + i, NumSamples - i, OutSamples + i);
+    }
+
+    HEIGHTMAP_DECODE_AVX2 void DecodeFloat32BigEndianAVX2(const uint8* Source, int64 NumSamples, float* OutSamples)
+    {
+        const __m256i Swap = _mm256_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        int64 i = 0;
+        for (; i + 8 <= NumSamples; i += 8)
+        {
+            const __m256i Value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source + i * 4));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(OutSamples + i), _mm256_shuffle_epi8(Value, Swap));
+        }
+        DecodeFloat32BigEndianScalar(Source + i * 4, NumSamples - i, OutSamples + i);
+    }
+
+    bool CpuSupportsAVX2()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int32 Info[4];
+        __cpuid(Info, 0);
+        if (Info[0] < 7)
+        {
+            return false;
+        }
+
+        // The OS must also save the YMM registers on context switches
+        __cpuid(Info, 1);
+        const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+        const bool bAVX = (Info[2] & (1 << 28)) != 0;
+        if (!bOSXSave || !bAVX || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        __cpuidex(Info, 7, 0);
+        return (Info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+
+#endif // PLATFORM_CPU_X86_FAMILY
+
+    enum class EDecodeInstructionSet : uint8
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    EDecodeInstructionSet GetInstructionSet()
+    {
+#if PLATFORM_CPU_X86_FAMILY
+        static const EDecodeInstructionSet InstructionSet = CpuSupportsAVX2() ? EDecodeInstructionSet::AVX2 : EDecodeInstructionSet::SSE2;
+        return InstructionSet;
+#else
+        return EDecodeInstructionSet::Scalar;
+#endif
+    }
+}
+
+HeightmapDecode::FKernel HeightmapDecode::GetKernel(EHeightmapSampleFormat Format)
+{
+#if PLATFORM_CPU_X86_FAMILY
+    const bool bAVX2 = GetInstructionSet() == EDecodeInstructionSet::AVX2;
+    switch (Format)
+    {
+    case EHeightmapSampleFormat::UInt8:            return bAVX2 ? &DecodeUInt8AVX2 : &DecodeUInt8SSE2;
+    case EHeightmapSampleFormat::UInt16:           return bAVX2 ? &DecodeUInt16AVX2<false> : &DecodeUInt16SSE2<false>;
+    case EHeightmapSampleFormat::UInt16BigEndian:  return bAVX2 ? &DecodeUInt16AVX2<true> : &DecodeUInt16SSE2<true>;
+    case EHeightmapSampleFormat::UInt32:           return &DecodeUInt32Scalar;
+    case EHeightmapSampleFormat::Float32:          return &DecodeFloat32Scalar;
+    case EHeightmapSampleFormat::Float32BigEndian: return bAVX2 ? &DecodeFloat32BigEndianAVX2 : &DecodeFloat32BigEndianSSE2;
+    }
+#else
+    switch (Format)
+    {
+    case EHeightmapSampleFormat::UInt8:            return &DecodeUInt8Scalar;
+    case EHeightmapSampleFormat::UInt16:           return &DecodeUInt16Scalar;
+    case EHeightmapSampleFormat::UInt16BigEndian:  return &DecodeUInt16BigEndianScalar;
+    case EHeightmapSampleFormat::UInt32:           return &DecodeUInt32Scalar;
+    case EHeightmapSampleFormat::Float32:          return &DecodeFloat32Scalar;
+    case EHeightmapSampleFormat::Float32BigEndian: return &DecodeFloat32BigEndianScalar;
+    }
+#endif
+
+    checkNoEntry();
+    return &DecodeFloat32Scalar;
+}
+
+void HeightmapDecode::DecodeParallel(EHeightmapSampleFormat Format, const uint8* Source, int64 NumSamples, float* OutSamples)
+{
+    const FKernel Kernel = GetKernel(Format);
+    const int32 BytesPerSample = GetBytesPerSample(Format);
+    const int32 NumChunks = static_cast<int32>((NumSamples + DECODE_CHUNK_SAMPLES - 1) / DECODE_CHUNK_SAMPLES);
+
+    ParallelFor(NumChunks, [&](int32 ChunkIndex)
+    {
+        const int64 First = ChunkIndex * DECODE_CHUNK_SAMPLES;
+        const int64 Count = FMath::Min(DECODE_CHUNK_SAMPLES, NumSamples - First);
+        Kernel(Source + First * BytesPerSample, Count, OutSamples + First);
+    });
+}
+
+int32 HeightmapDecode::GetBytesPerSample(EHeightmapSampleFormat Format)
+{
+    switch (Format)
+    {
+    case EHeightmapSampleFormat::UInt8:
+        return 1;
+    case EHeightmapSampleFormat::UInt16:
+    case EHeightmapSampleFormat::UInt16BigEndian:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
+const TCHAR* HeightmapDecode::GetInstructionSetName()
+{
+    switch (GetInstructionSet())
+    {
+    case EDecodeInstructionSet::AVX2: return TEXT("AVX2");
+    case EDecodeInstructionSet::SSE2: return TEXT("SSE2");
+    default:                          return TEXT("scalar");
+    }
+}
@@ -8,6 +8,9 @@
 #include "OceanTemperature.h"
 #include "Precipitation.h"
 #include "UnifiedWindCalculator.h"
+#include "MappedHeightmapFile.h"
+#include "HeightmapDecode.h"
+#include "BiomeJobProgress.h"
 #include "Misc/FileHelper.h"
 #include "Math/UnrealMathUtility.h"
 #include "IImageWrapper.h"
@@ -16,40 +19,69 @@
 
 bool UHeightmapParser::ParseHeightmap(
     const FString& FilePath,
-    FInputParameters& InputParams,
+    const FBiomeSimulationContext& Context,
     float& OutMinLongitude,
     float& OutMaxLongitude,
-    TArray<FHeightmapCell>& OutHeightmapData,
+    FClimateGrid& OutGrid,
     int32& OutWidth,
     int32& OutHeight,
-    FVector2D& OutResolution)
+    FVector2D& OutResolution,
+    FBiomeJobProgress* Progress)
 {
     TArray<float> RawData;
     int32 BitDepth = 0;
 
+    if (Progress)
+    {
+        Progress->BeginStage(TEXT("Loading heightmap"));
+    }
+
     if (!LoadHeightmap(FilePath, RawData, OutWidth, OutHeight, BitDepth))
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to load heightmap: %s"), *FilePath);
         return false;
     }
 
-    if (OutWidth <= 0 || OutHeight <= 0)
+    UE_LOG(LogTemp, Log, TEXT("Decoded %d-bit heightmap samples with %s kernels."), BitDepth, HeightmapDecode::GetInstructionSetName());
+
+    if (IsJobCancelled(Progress))
     {
-        UE_LOG(LogTemp, Error, TEXT("Invalid heightmap dimensions: %dx%d"), OutWidth, OutHeight);
         return false;
     }
 
-    if (OutWidth * OutHeight != RawData.Num())
+    return ProcessHeightmapSamples(RawData, OutWidth, OutHeight, Context, OutMinLongitude, OutMaxLongitude, OutGrid, OutResolution, Progress);
+}
+
+bool UHeightmapParser::ProcessHeightmapSamples(
+    const TArray<float>& RawData,
+    int32 Width,
+    int32 Height,
+    const FBiomeSimulationContext& Context,
+    float& OutMinLongitude,
+    float& OutMaxLongitude,
+    FClimateGrid& OutGrid,
+    FVector2D& OutResolution,
+    FBiomeJobProgress* Progress)
+{
+    const FInputParameters& InputParams = Context.InputParams;
+
+    if (Width <= 0 || Height <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid heightmap dimensions: %dx%d"), Width, Height);
+        return false;
+    }
+
+    if (Width * Height != RawData.Num())
     {
-        UE_LOG(LogTemp, Error, TEXT("Mismatch between heightmap dimensions and data size. Width: %d, Height: %d, RawData size: %d"), OutWidth, OutHeight, RawData.Num());
+        UE_LOG(LogTemp, Error, TEXT("Mismatch between heightmap dimensions and data size. Width: %d, Height: %d, RawData size: %d"), Width, Height, RawData.Num());
         return false;
     }
 
     EstimateLongitudeRange(
         InputParams.SouthernLatitude, 
         InputParams.NorthernLatitude, 
-        OutWidth, 
-        OutHeight, 
+        Width, 
+        Height, 
         InputParams.CentralLongitude,
         OutMinLongitude, 
         OutMaxLongitude);
@@ -58,76 +90,142 @@ bool UHeightmapParser::ParseHeightmap(
     float LatitudeRange = InputParams.NorthernLatitude - InputParams.SouthernLatitude;
     float LongitudeRange = OutMaxLongitude - OutMinLongitude;
 
-    OutResolution.X = OutHeight / LatitudeRange; // Pixels per degree latitude
-    OutResolution.Y = OutWidth / LongitudeRange; // Pixels per degree longitude
+    OutResolution.X = Height / LatitudeRange; // Pixels per degree latitude
+    OutResolution.Y = Width / LongitudeRange; // Pixels per degree longitude
 
     // Log resolution for debugging
     UE_LOG(LogTemp, Log, TEXT("Heightmap resolution: %f px/degree (latitude), %f px/degree (longitude)"), OutResolution.X, OutResolution.Y);
 
-    // Parse raw data into heightmap cells
-    OutHeightmapData.Empty(OutWidth * OutHeight);
-    for (int32 y = 0; y < OutHeight; ++y)
+    if (Progress)
     {
-        for (int32 x = 0; x < OutWidth; ++x)
-        {
-            int32 Index = y * OutWidth + x;
+        Progress->BeginStage(TEXT("Building climate grid"));
+    }
 
-             if (Index >= RawData.Num())
-            {
-                UE_LOG(LogTemp, Error, TEXT("Index out of bounds: %d, RawData size: %d"), Index, RawData.Num());
-                return false;
-            }
+    // Parse raw data into the climate grid
+    BuildClimateGrid(RawData.GetData(), FIntRect(0, 0, Width, Height), Width, Height,
+        InputParams, OutMinLongitude, OutMaxLongitude, OutGrid);
 
-             // Normalize RawData value
-            float NormalizedValue = FMath::Clamp(RawData[Index], 0.0f, 1.0f);
+    if (IsJobCancelled(Progress))
+    {
+        return false;
+    }
 
-            // Convert normalized value to pixel value
-            uint8 PixelValue = static_cast<uint8>(NormalizedValue * 255.0f);
+    if (Progress)
+    {
+        Progress->BeginStage(TEXT("Distance to ocean"));
+    }
 
-            FHeightmapCell Cell;
-            Cell.Latitude = InputParams.SouthernLatitude + 
-                            (InputParams.NorthernLatitude - InputParams.SouthernLatitude) * 
-                            (y / static_cast<float>(OutHeight));
-            Cell.Longitude = OutMinLongitude + 
-                            (OutMaxLongitude - OutMinLongitude) * 
-                            (x / static_cast<float>(OutWidth));
-            Cell.Altitude = CalculateAltitude(PixelValue, InputParams.MinimumAltitude, InputParams.MaximumAltitude);
+    // DistanceToOcean calculation
+    if (!CalculateDistanceToOcean(OutGrid))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to calculate distances to ocean."));
+        return false;
+    }
 
-            if (Cell.Altitude <= InputParams.SeaLevel)
-            {
-                Cell.OceanDepth = CalculateOceanDepth(InputParams.SeaLevel, Cell.Altitude);
-                Cell.DistanceToOcean = 0.0f;
-                Cell.CellType = ECellType::Ocean;
+    // Preprocess additional derived data
+    return Preprocessing::PreprocessData(OutGrid, Context, Progress);
+}
 
-                // Assign ocean temperature based on latitude and current type
-                float BaseOceanTemperature = FMath::Clamp(30.0f - FMath::Abs(Cell.Latitude) * 0.5f, -2.0f, 30.0f);
-                FString CurrentType = OceanCurrents::DetermineOceanCurrentType(Cell.Latitude, Cell.Longitude, Cell.FlowDirection);
-                Cell.ClosestOceanTemperature = (CurrentType == "warm") ? BaseOceanTemperature + 7.5f : BaseOceanTemperature - 7.5f;
+float UHeightmapParser::GetRowLatitude(const FInputParameters& InputParams, int32 Row, int32 FullHeight)
+{
+    return InputParams.SouthernLatitude + 
+           (InputParams.NorthernLatitude - InputParams.SouthernLatitude) * 
+           (Row / static_cast<float>(FullHeight));
+}
 
-                // Determine the Ocean Current Flow Direction
-                Cell.FlowDirection = FString(OceanCurrents::ValidateFlowDirection(Cell.Latitude, Cell.Longitude, Cell.FlowDirection));
-            }
-            else
-            {
-                Cell.OceanDepth = 0.0f;
-                Cell.CellType = ECellType::Land;                
-            }
+float UHeightmapParser::GetColumnLongitude(float MinLongitude, float MaxLongitude, int32 Column, int32 FullWidth)
+{
+    return MinLongitude + 
+           (MaxLongitude - MinLongitude) * 
+           (Column / static_cast<float>(FullWidth));
+}
 
-            OutHeightmapData.Add(Cell);
-        }
+void UHeightmapParser::BuildClimateGrid(
+    const float* RegionSamples,
+    const FIntRect& Region,
+    int32 FullWidth,
+    int32 FullHeight,
+    const FInputParameters& InputParams,
+    float MinLongitude,
+    float MaxLongitude,
+    FClimateGrid& OutGrid)
+{
+    const int32 RegionWidth = Region.Width();
+    const int32 RegionHeight = Region.Height();
+
+    OutGrid.Init(RegionWidth, RegionHeight);
+
+    // Latitude depends only on the row and longitude only on the column
+    for (int32 y = 0; y < RegionHeight; ++y)
+    {
+        OutGrid.RowLatitude[y] = GetRowLatitude(InputParams, Region.Min.Y + y, FullHeight);
+    }
+    for (int32 x = 0; x < RegionWidth; ++x)
+    {
+        OutGrid.ColumnLongitude[x] = GetColumnLongitude(MinLongitude, MaxLongitude, Region.Min.X + x, FullWidth);
     }
 
-    // DistanceToOcean calculation
-    if (!CalculateDistanceToOcean(OutHeightmapData, OutWidth, OutHeight))
+    // The same resolution as the whole heightmap, so tiles see the same cell spacing
+    const float LatitudeRange = InputParams.NorthernLatitude - InputParams.SouthernLatitude;
+    const float LongitudeRange = MaxLongitude - MinLongitude;
+    if (LatitudeRange > 0.0f && LongitudeRange > 0.0f)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to calculate distances to ocean."));
-        return false;
+        OutGrid.Resolution = FVector2D(FullHeight / LatitudeRange, FullWidth / LongitudeRange);
     }
 
-    // Preprocess additional derived data
-    Preprocessing::PreprocessData(OutHeightmapData, OutWidth, OutHeight);
+    const float SeaLevel = InputParams.SeaLevel;
 
-    return true;
+    // Rows are independent; each task fills one row plane by plane so the inner loops vectorize
+    ParallelFor(RegionHeight, [&](int32 y)
+    {
+        const int32 RowStart = y * RegionWidth;
+        const float* RowSamples = RegionSamples + RowStart;
+        float* RowAltitude = OutGrid.Altitude.GetData() + RowStart;
+        float* RowOceanDepth = OutGrid.OceanDepth.GetData() + RowStart;
+        ECellType* RowCellType = OutGrid.CellType.GetData() + RowStart;
+
+        // Samples keep their source precision all the way to metres
+        CalculateAltitudes(RowSamples, RegionWidth, InputParams.MinimumAltitude, InputParams.MaximumAltitude, RowAltitude);
+
+        bool bRowHasOcean = false;
+        for (int32 x = 0; x < RegionWidth; ++x)
+        {
+            const bool bIsOcean = RowAltitude[x] <= SeaLevel;
+            RowOceanDepth[x] = bIsOcean ? CalculateOceanDepth(SeaLevel, RowAltitude[x]) : 0.0f;
+            RowCellType[x] = bIsOcean ? ECellType::Ocean : ECellType::Land;
+            bRowHasOcean |= bIsOcean;
+        }
+
+        if (!bRowHasOcean)
+        {
+            return;
+        }
+
+        // Ocean attributes only depend on the latitude and on the sign of the longitude
+        const float Latitude = OutGrid.RowLatitude[y];
+        const EOceanFlowDirection EastFlow = OceanCurrents::GetFlowDirection(Latitude, 0.0f);
+        const EOceanFlowDirection WestFlow = OceanCurrents::GetFlowDirection(Latitude, -1.0f);
+        const EOceanCurrentType EastCurrent = OceanCurrents::GetCurrentType(Latitude, EastFlow);
+        const EOceanCurrentType WestCurrent = OceanCurrents::GetCurrentType(Latitude, WestFlow);
+
+        // Assign ocean temperature based on latitude and current type
+        const float EastOceanTemperature = OceanTemperature::CalculateSurfaceTemperature(Latitude, EastCurrent);
+        const float WestOceanTemperature = OceanTemperature::CalculateSurfaceTemperature(Latitude, WestCurrent);
+
+        for (int32 x = 0; x < RegionWidth; ++x)
+        {
+            if (RowCellType[x] == ECellType::Ocean)
+            {
+                const int32 Index = RowStart + x;
+                const bool bEast = OutGrid.ColumnLongitude[x] >= 0.0f;
+
+                OutGrid.DistanceToOcean[Index] = 0.0f;
+                OutGrid.ClosestOceanTemperature[Index] = bEast ? EastOceanTemperature : WestOceanTemperature;
+                OutGrid.ClosestOceanCurrentType[Index] = bEast ? EastCurrent : WestCurrent;
+                OutGrid.FlowDirection[Index] = bEast ? EastFlow : WestFlow;
+            }
+        }
+    });
 }
 
 bool UHeightmapParser::LoadHeightmap(
@@ -155,6 +253,45 @@ bool UHeightmapParser::LoadHeightmap(
     }
 }
 
+bool UHeightmapParser::ReadHeightmapDimensions(const FString& FilePath, int32& OutWidth, int32& OutHeight)
+{
+    const FString FileExtension = FPaths::GetExtension(FilePath).ToLower();
+    OutWidth = 0;
+    OutHeight = 0;
+
+    if (FileExtension == TEXT("png") || FileExtension == TEXT("jpg") || FileExtension == TEXT("jpeg"))
+    {
+        TArray<uint8> FileData;
+        if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to load image file: %s"), *FilePath);
+            return false;
+        }
+
+        // SetCompressed only reads the header; nothing is decompressed until GetRaw
+        IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+        TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+        if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(FileData.GetData(), FileData.Num()))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Invalid or unsupported image format: %s"), *FilePath);
+            return false;
+        }
+
+        OutWidth = ImageWrapper->GetWidth();
+        OutHeight = ImageWrapper->GetHeight();
+        return OutWidth > 0 && OutHeight > 0;
+    }
+    else if (FileExtension == TEXT("r16") || FileExtension == TEXT("r32") || FileExtension == TEXT("raw"))
+    {
+        int32 BitDepth = (FileExtension == TEXT("r16")) ? 16 : 32;
+        FMappedHeightmapFile MappedFile;
+        return OpenRawHeightmap(FilePath, MappedFile, OutWidth, OutHeight, BitDepth);
+    }
+
+    UE_LOG(LogTemp, Error, TEXT("Unsupported file format: %s"), *FileExtension);
+    return false;
+}
+
 bool UHeightmapParser::ParseImageHeightmap(
     const FString& FilePath,
     TArray<float>& OutRawData,
@@ -187,61 +324,20 @@ bool UHeightmapParser::ParseImageHeightmap(
     OutWidth = ImageWrapper->GetWidth();
     OutHeight = ImageWrapper->GetHeight();
     BitDepth = ImageWrapper->GetBitDepth();
+
+    // Image wrappers return little-endian gray samples, normalized to [0.0, 1.0] using the maximum for the bit depth
+    EHeightmapSampleFormat Format;
     if (BitDepth == 32)
     {
-        TArray<uint8> RawByteData;
-        if (!ImageWrapper->GetRaw(ERGBFormat::Gray, 32, RawByteData))
-        {
-            UE_LOG(LogTemp, Error, TEXT("Failed to decompress 32-bit image: %s"), *FilePath);
-            return false;
-        }
-
-        // Convert raw byte data directly to normalized floating-point values
-        int32 NumPixels = RawByteData.Num() / 4; // Each pixel is 4 bytes
-        OutRawData.Reserve(NumPixels);
-
-        for (int32 i = 0; i < RawByteData.Num(); i += 4)
-        {
-            uint32 Value = (RawByteData[i + 3] << 24) | (RawByteData[i + 2] << 16) |
-                        (RawByteData[i + 1] << 8) | RawByteData[i]; // Combine bytes into a 32-bit integer
-
-            // Normalize to [0.0, 1.0] using the maximum possible value for 32-bit data
-            OutRawData.Add(static_cast<float>(Value) / 4294967295.0f);
-        }
+        Format = EHeightmapSampleFormat::UInt32;
     }
     else if (BitDepth == 16)
     {
-        TArray<uint8> RawByteData;
-        if (!ImageWrapper->GetRaw(ERGBFormat::Gray, 16, RawByteData))
-        {
-            UE_LOG(LogTemp, Error, TEXT("Failed to decompress 16-bit image: %s"), *FilePath);
-            return false;
-        }
-
-        // Convert raw byte data directly to normalized floating-point values
-        int32 NumPixels = RawByteData.Num() / 2; // Each pixel is 2 bytes
-        OutRawData.Reserve(NumPixels);
-
-        for (int32 i = 0; i < RawByteData.Num(); i += 2)
-        {
-            uint16 Value = (RawByteData[i + 1] << 8) | RawByteData[i]; // Combine bytes into a 16-bit integer
-            OutRawData.Add(static_cast<float>(Value) / 65535.0f); // Normalize to [0.0, 1.0] and store as float
-        }
+        Format = EHeightmapSampleFormat::UInt16;
     }
     else if (BitDepth == 8)
     {
-        TArray<uint8> Raw8BitData;
-        if (!ImageWrapper->GetRaw(ERGBFormat::Gray, 8, Raw8BitData))
-        {
-            UE_LOG(LogTemp, Error, TEXT("Failed to decompress 8-bit image: %s"), *FilePath);
-            return false;
-        }
-
-        OutRawData.Reserve(Raw8BitData.Num());
-        for (uint8 Value : Raw8BitData)
-        {
-            OutRawData.Add(Value / 255.0f); // Normalize to [0.0, 1.0]
-        }
+        Format = EHeightmapSampleFormat::UInt8;
     }
     else
     {
@@ -249,6 +345,18 @@ bool UHeightmapParser::ParseImageHeightmap(
         return false;
     }
 
+    TArray<uint8> RawByteData;
+    if (!ImageWrapper->GetRaw(ERGBFormat::Gray, BitDepth, RawByteData))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to decompress %d-bit image: %s"), BitDepth, *FilePath);
+        return false;
+    }
+
+    // Swap, widen and normalize in one pass with the kernel for this CPU
+    const int32 NumPixels = RawByteData.Num() / HeightmapDecode::GetBytesPerSample(Format);
+    OutRawData.SetNumUninitialized(NumPixels);
+    HeightmapDecode::DecodeParallel(Format, RawByteData.GetData(), NumPixels, OutRawData.GetData());
+
     return true;
 }
 
@@ -259,32 +367,37 @@ bool UHeightmapParser::ParseRawHeightmap(
     int32& OutHeight,
     int32 BitDepth)
 {
-    TArray<uint8> RawData;
-   if (!FFileHelper::LoadFileToArray(RawData, *FilePath))
+    // Map the file rather than loading it; samples are decoded straight from the mapping
+    FMappedHeightmapFile MappedFile;
+    if (!OpenRawHeightmap(FilePath, MappedFile, OutWidth, OutHeight, BitDepth))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to load raw heightmap file: %s"), *FilePath);
         return false;
     }
 
-    if (IsBigEndian(RawData, BitDepth))
+    // Decode the mapped samples (byte-swapping if needed) directly into the output plane
+    return MappedFile.DecodeToPlane(BitDepth, OutHeightmapData);
+}
+
+bool UHeightmapParser::OpenRawHeightmap(
+    const FString& FilePath,
+    FMappedHeightmapFile& OutMappedFile,
+    int32& OutWidth,
+    int32& OutHeight,
+    int32& InOutBitDepth)
+{
+    if (!OutMappedFile.Open(FilePath))
     {
-        if (BitDepth == 16)
-        {
-            ConvertToLittleEndian(RawData);
-        }
-        else if (BitDepth == 32)
-        {
-            ConvertToLittleEndian32(RawData);
-        }
+        UE_LOG(LogTemp, Error, TEXT("Failed to load raw heightmap file: %s"), *FilePath);
+        return false;
     }
 
-    int64 FileSize = RawData.Num();
+    int64 FileSize = OutMappedFile.GetFileSize();
 
     // Step 1: Attempt to read metadata
     FString MetadataFilePath = FPaths::ChangeExtension(FilePath, TEXT("hdr"));
     if (FPaths::FileExists(MetadataFilePath))
     {
-        if (ReadMetadataFromFile(MetadataFilePath, OutWidth, OutHeight, BitDepth))
+        if (ReadMetadataFromFile(MetadataFilePath, OutWidth, OutHeight, InOutBitDepth))
         {
             UE_LOG(LogTemp, Log, TEXT("Metadata file used to determine dimensions: %dx%d"), OutWidth, OutHeight);
         }
@@ -293,12 +406,12 @@ bool UHeightmapParser::ParseRawHeightmap(
     // Step 2: Infer dimensions from file size if metadata is not available
     if (OutWidth == 0 || OutHeight == 0)
     {
-        if (!DetermineDimensionsFromFile(FileSize, BitDepth, OutWidth, OutHeight))
+        if (!DetermineDimensionsFromFile(FileSize, InOutBitDepth, OutWidth, OutHeight))
         {
             UE_LOG(LogTemp, Warning, TEXT("Determining dimensions failed, attempting to guess dimensions."));
 
             // Step 3: Guess dimensions as a fallback
-            if (!GuessDimensions(FileSize, BitDepth, OutWidth, OutHeight))
+            if (!GuessDimensions(FileSize, InOutBitDepth, OutWidth, OutHeight))
             {
                 UE_LOG(LogTemp, Error, TEXT("Failed to determine dimensions for file: %s"), *FilePath);
                 return false;
@@ -306,33 +419,6 @@ bool UHeightmapParser::ParseRawHeightmap(
         }
     }
 
-    // Step 4: Parse the raw data into floating-point values
-    int32 BytesPerPixel = BitDepth / 8;
-    int32 NumSamples = FileSize / BytesPerPixel;
-    OutHeightmapData.Reserve(NumSamples);
-
-    if (BitDepth == 16)
-    {
-        for (int32 i = 0; i < RawData.Num(); i += 2)
-        {
-            uint16 Value = (RawData[i + 1] << 8) | RawData[i];
-            OutHeightmapData.Add(Value / 65535.0f); // Normalize to [0.0, 1.0]
-        }
-    }
-    else if (BitDepth == 32)
-    {
-        for (int32 i = 0; i < RawData.Num(); i += 4)
-        {
-            uint32 Value = (RawData[i + 3] << 24) | (RawData[i + 2] << 16) | (RawData[i + 1] << 8) | RawData[i];
-            OutHeightmapData.Add(*reinterpret_cast<float*>(&Value));
-        }
-    }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("Unsupported bit depth: %d"), BitDepth);
-        return false;
-    }
-
     return true;
 }
 
@@ -356,46 +442,6 @@ bool UHeightmapParser::ParseRawHeightmap(
     OutMaxLongitude = CentralLongitude + HalfLongitudeRange;
 }
 
-bool UHeightmapParser::IsBigEndian(const TArray<uint8>& Data, int32 BitDepth)
-{
-    if (BitDepth == 16)
-    {
-        uint16 Value = *(reinterpret_cast<const uint16*>(Data.GetData()));
-        return Value > 0xFF;
-    }
-    else if (BitDepth == 32)
-    {
-        uint32 Value = *(reinterpret_cast<const uint32*>(Data.GetData()));
-        return Value > 0xFFFFFF;
-    }
-    return false;
-}
-
-void UHeightmapParser::ConvertToLittleEndian(TArray<uint8>& Data)
-{
-    int32 NumValues = Data.Num() / 2;
-    ParallelFor(NumValues, [&Data](int32 Index)
-    {
-        uint8 Temp = Data[Index * 2];
-        Data[Index * 2] = Data[Index * 2 + 1];
-        Data[Index * 2 + 1] = Temp;
-    });
-}
-
-void UHeightmapParser::ConvertToLittleEndian32(TArray<uint8>& Data)
-{
-    int32 NumValues = Data.Num() / 4;
-    ParallelFor(NumValues, [&Data](int32 Index)
-    {
-        uint8 Temp1 = Data[Index * 4];
-        uint8 Temp2 = Data[Index * 4 + 1];
-        Data[Index * 4] = Data[Index * 4 + 3];
-        Data[Index * 4 + 1] = Data[Index * 4 + 2];
-        Data[Index * 4 + 2] = Temp2;
-        Data[Index * 4 + 3] = Temp1;
-    });
-}
-
 bool UHeightmapParser::DetermineDimensionsFromFile(int64 FileSize, int32 BitDepth, int32& OutWidth, int32& OutHeight)
 {
     int32 BytesPerPixel = BitDepth / 8;
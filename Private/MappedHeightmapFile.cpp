@@ -0,0 +1,126 @@
+#include "MappedHeightmapFile.h"
+#include "HeightmapDecode.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+FMappedHeightmapFile::FMappedHeightmapFile()
+    : Data(nullptr),
+      Size(0)
+{
+}
+
+FMappedHeightmapFile::~FMappedHeightmapFile()
+{
+    Close();
+}
+
+bool FMappedHeightmapFile::Open(const FString& FilePath)
+{
+    Close();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    MappedHandle.Reset(PlatformFile.OpenMapped(*FilePath));
+
+    if (MappedHandle.IsValid() && MappedHandle->GetFileSize() > 0)
+    {
+        MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize(), true));
+        if (MappedRegion.IsValid())
+        {
+            Data = MappedRegion->GetMappedPtr();
+            Size = MappedRegion->GetMappedSize();
+            return true;
+        }
+    }
+
+    // Not every platform file layer supports mapping (e.g. pak files); load the file instead
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+
+    UE_LOG(LogTemp, Warning, TEXT("Memory mapping unavailable, loading raw heightmap into memory: %s"), *FilePath);
+    if (!FFileHelper::LoadFileToArray(FallbackData, *FilePath) || FallbackData.Num() == 0)
+    {
+        FallbackData.Empty();
+        return false;
+    }
+
+    Data = FallbackData.GetData();
+    Size = FallbackData.Num();
+    return true;
+}
+
+void FMappedHeightmapFile::Close()
+{
+    // The region must be released before the handle that owns it
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+    FallbackData.Empty();
+
+    Data = nullptr;
+    Size = 0;
+}
+
+int64 FMappedHeightmapFile::GetNumSamples(int32 BitDepth) const
+{
+    const int32 BytesPerSample = BitDepth / 8;
+    return BytesPerSample > 0 ? Size / BytesPerSample : 0;
+}
+
+bool FMappedHeightmapFile::IsBigEndian(int32 BitDepth) const
+{
+    if (BitDepth == 16 && Size >= 2)
+    {
+        uint16 Value;
+        FMemory::Memcpy(&Value, Data, sizeof(Value));
+        return Value > 0xFF;
+    }
+    else if (BitDepth == 32 && Size >= 4)
+    {
+        uint32 Value;
+        FMemory::Memcpy(&Value, Data, sizeof(Value));
+        return Value > 0xFFFFFF;
+    }
+    return false;
+}
+
+EHeightmapSampleFormat FMappedHeightmapFile::GetSampleFormat(int32 BitDepth, bool bBigEndian)
+{
+    // 16-bit samples are normalized to [0.0, 1.0], 32-bit samples are IEEE floats
+    if (BitDepth == 16)
+    {
+        return bBigEndian ? EHeightmapSampleFormat::UInt16BigEndian : EHeightmapSampleFormat::UInt16;
+    }
+    return bBigEndian ? EHeightmapSampleFormat::Float32BigEndian : EHeightmapSampleFormat::Float32;
+}
+
+void FMappedHeightmapFile::DecodeSamples(int32 BitDepth, bool bBigEndian, int64 FirstSample, int64 NumSamples, float* OutSamples) const
+{
+    if (BitDepth != 16 && BitDepth != 32)
+    {
+        return;
+    }
+
+    const EHeightmapSampleFormat Format = GetSampleFormat(BitDepth, bBigEndian);
+    HeightmapDecode::GetKernel(Format)(Data + FirstSample * HeightmapDecode::GetBytesPerSample(Format), NumSamples, OutSamples);
+}
+
+bool FMappedHeightmapFile::DecodeToPlane(int32 BitDepth, TArray<float>& OutSamples) const
+{
+    if (BitDepth != 16 && BitDepth != 32)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Unsupported bit depth: %d"), BitDepth);
+        return false;
+    }
+
+    const int64 NumSamples = GetNumSamples(BitDepth);
+    if (NumSamples > MAX_int32)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Raw heightmap has too many samples for a single plane: %lld"), NumSamples);
+        return false;
+    }
+
+    OutSamples.SetNumUninitialized(static_cast<int32>(NumSamples));
+    HeightmapDecode::DecodeParallel(GetSampleFormat(BitDepth, IsBigEndian(BitDepth)), Data, NumSamples, OutSamples.GetData());
+
+    return true;
+}
@@ -0,0 +1,18 @@
+#include "OceanProximityCache.h"
+
+void FOceanProximityCache::Empty()
+{
+    Key = FOceanProximityKey();
+    ClosestOceanIndex.Empty();
+    bAppliedToGrid = false;
+}
+
+bool FOceanProximityCache::Matches(const FOceanProximityKey& InKey) const
+{
+    return ClosestOceanIndex.Num() > 0 && Key == InKey;
+}
+
+SIZE_T FOceanProximityCache::GetAllocatedSize() const
+{
+    return ClosestOceanIndex.GetAllocatedSize();
+}
@@ -1,20 +1,34 @@
 #include "OceanTemperature.h"
 #include "OceanCurrents.h" // Include the header file for OceanCurrents
 
-float OceanTemperature::CalculateOceanTemp(float Temperature, float DistanceToOcean, float Latitude, float Longitude, FString FlowDirection)
+float OceanTemperature::CalculateOceanTemp(float Temperature, float DistanceToOcean, float Latitude, float Longitude, EOceanFlowDirection FlowDirection)
+{
+    return ApplyWaterEffect(Temperature, DistanceToOcean, CalculateWaterEffect(Latitude, Longitude));
+}
+
+float OceanTemperature::CalculateWaterEffect(float Latitude, float Longitude)
 {
     // Determine the ocean current type (warm or cold)
-    FString CurrentType = OceanCurrents::DetermineOceanCurrentType(Latitude, Longitude, FlowDirection);
+    EOceanCurrentType CurrentType = OceanCurrents::GetCurrentType(Latitude, OceanCurrents::GetFlowDirection(Latitude, Longitude));
 
     // Define WaterEffect based on the current type
     //float WaterEffect = GetWaterEffect(CurrentType, IsSummer); for when seasons are implemented
     //float WaterEffect = (CurrentType == "warm") ? 7.50f : -7.5f; // Simplistic approach
 
     float BaseOceanTemperature = FMath::Clamp(30.0f - FMath::Abs(Latitude) * 0.5f, -2.0f, 30.0f);
-    float WaterEffect = (CurrentType == "warm") ? BaseOceanTemperature + 5.0f : BaseOceanTemperature - 5.0f;
+    return (CurrentType == EOceanCurrentType::Warm) ? BaseOceanTemperature + 5.0f : BaseOceanTemperature - 5.0f;
+}
 
+float OceanTemperature::ApplyWaterEffect(float Temperature, float DistanceToOcean, float WaterEffect)
+{
     // Apply the temperature adjustment based on WaterEffect and DistanceToOcean
     Temperature += WaterEffect / ((DistanceToOcean / 1000.0f) + 1);
 
     return Temperature;
 }
+
+float OceanTemperature::CalculateSurfaceTemperature(float Latitude, EOceanCurrentType CurrentType)
+{
+    const float BaseOceanTemperature = FMath::Clamp(30.0f - FMath::Abs(Latitude) * 0.5f, -2.0f, 30.0f);
+    return (CurrentType == EOceanCurrentType::Warm) ? BaseOceanTemperature + 7.5f : BaseOceanTemperature - 7.5f;
+}
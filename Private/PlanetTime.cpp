@@ -1,9 +1,6 @@
 #include "PlanetTime.h"
 
-// Static Instance Initialization
-FPlanetTime* FPlanetTime::Instance = nullptr;
-
-// Private Constructors
+// Constructors
 FPlanetTime::FPlanetTime()
     : YearLength(365.0f), DayLengthHours(24.0f), DayLengthMinutes(0.0f), DayLengthSeconds(86400.0f), DayOfYear(1), TimeOfDay(0.0f)
 {
@@ -19,21 +16,6 @@ FPlanetTime::FPlanetTime(float YearLengthDays, float DayLengthHours, float DayLe
 {
 }
 
-// Singleton Access
-FPlanetTime& FPlanetTime::GetInstance()
-{
-    ensure(Instance != nullptr); // Ensure it is initialized before use
-    return *Instance;
-}
-
-// Initialize Singleton
-void FPlanetTime::Initialize(float YearLengthDays, float DayLengthHours, float DayLengthMinutes, int32 DayOfYear, float TimeOfDay)
-{
-    if (Instance == nullptr)
-    {
-        Instance = new FPlanetTime(YearLengthDays, DayLengthHours, DayLengthMinutes, DayOfYear, TimeOfDay);
-    }
-}
 // Getters
 float FPlanetTime::GetYearLength() const { return YearLength; }
 float FPlanetTime::GetDayLengthHours() const { return DayLengthHours; }
@@ -67,6 +49,14 @@ void FPlanetTime::SetTimeOfDay(float NewTimeOfDay)
     this->TimeOfDay = FMath::Clamp(NewTimeOfDay, 0.0f, 1.0f); 
 }
 
+bool FPlanetTime::operator==(const FPlanetTime& Other) const
+{
+    return YearLength == Other.YearLength &&
+           DayLengthSeconds == Other.DayLengthSeconds &&
+           DayOfYear == Other.DayOfYear &&
+           TimeOfDay == Other.TimeOfDay;
+}
+
 // Determine Season
 FString FPlanetTime::GetSeason(float TimeOfYear) const
 {
@@ -1,6 +1,6 @@
 #include "Precipitation.h"
-#include "WindUtils.h"
 #include "SlopeAndAspect.h"
+#include "ClimateMath.h"
 #include "Math/UnrealMathUtility.h"
 
 float Precipitation::CalculatePrecipitation(
@@ -11,19 +11,62 @@ float Precipitation::CalculatePrecipitation(
     FVector2D WindDirection,
     FVector2D OceanToLandVector)
 {
-    // Latitude-based precipitation (scaled to reflect wet tropics and drier poles)
-    float LatitudeFactor = 2000.0f * FMath::Clamp(FMath::Cos(FMath::DegreesToRadians(Latitude)), 0.0f, 1.0f);
+    return CalculatePrecipitationFromLatitudeFactor(
+        CalculateLatitudeFactor(Latitude), Altitude, DistanceToOcean, Slope, WindDirection, OceanToLandVector);
+}
 
+float Precipitation::CalculateOceanFactor(float DistanceToOcean)
+{
     // Ocean proximity effect: Decreases precipitation with distance from ocean
-   float OceanFactor = 200.0f * FMath::Exp(-DistanceToOcean / 50000.0f); // Adjusted for meters
+    return 200.0f * FMath::Exp(-DistanceToOcean / 50000.0f); // Adjusted for meters
+}
+
+void Precipitation::CalculateOceanFactors(const float* DistanceToOcean, float* OutFactors, int32 Num, EClimateMathMode MathMode)
+{
+    for (int32 i = 0; i < Num; ++i)
+    {
+        OutFactors[i] = -DistanceToOcean[i] / 50000.0f;
+    }
+
+    ClimateMath::Exp(OutFactors, OutFactors, Num, MathMode);
 
+    for (int32 i = 0; i < Num; ++i)
+    {
+        OutFactors[i] *= 200.0f;
+    }
+}
+
+float Precipitation::CalculateLatitudeFactor(float Latitude)
+{
+    // Latitude-based precipitation (scaled to reflect wet tropics and drier poles)
+    return 2000.0f * FMath::Clamp(FMath::Cos(FMath::DegreesToRadians(Latitude)), 0.0f, 1.0f);
+}
+
+float Precipitation::CalculatePrecipitationFromLatitudeFactor(
+    float LatitudeFactor,
+    float Altitude,
+    float DistanceToOcean,
+    float Slope,
+    FVector2D WindDirection,
+    FVector2D OceanToLandVector)
+{
+    return CalculatePrecipitationFromFactors(
+        LatitudeFactor, CalculateOceanFactor(DistanceToOcean), Altitude, Slope, WindDirection, OceanToLandVector);
+}
+
+float Precipitation::CalculatePrecipitationFromFactors(
+    float LatitudeFactor,
+    float OceanFactor,
+    float Altitude,
+    float Slope,
+    FVector2D WindDirection,
+    FVector2D OceanToLandVector)
+{
     // Altitude effect: Increases up to 2 km, then decreases    
     float AltitudeFactor = (Altitude < 2000.0f) ? 0.2f * Altitude : -5.0f * (Altitude - 2000.0f) / 1000.0f;
 
-    // Orographic effect
-    float OrographicEffect = (Slope > 5.0f && WindUtils::IsOnshoreWind(WindDirection, OceanToLandVector)) ? FMath::Pow(Slope, 1.2f) * 15.0f : 0.0f;
-
-    // Combine all factors
+    // Combine all factors; the orographic effect of slope and onshore wind is not part of the sum,
+    // matching the ISPC climate kernel
     float Precipitation = (LatitudeFactor + OceanFactor + AltitudeFactor);
 
     // Ensure non-negative precipitation
@@ -1,108 +1,29 @@
 #include "Preprocessing.h"
-#include "Async/ParallelFor.h"
 #include "DistanceToOcean.h"
-#include "PlanetTime.h"
-#include "UnifiedWindCalculator.h"
-#include "WindUtils.h"
-#include "Precipitation.h"
-#include "Temperature.h"
-#include "OceanCurrents.h"
-#include "OceanTemperature.h"
-#include "Albedo.h"
 #include "SlopeAndAspect.h"
-#include "Misc/FileHelper.h"
+#include "BiomeJobProgress.h"
 
-float ALBEDO_EFFECT = 5.0f;         // Albedo effect on temperature (°C)
-
-bool Preprocessing::PreprocessData(TArray<FHeightmapCell>& HeightmapData, int32 Width, int32 Height)
+bool Preprocessing::PreprocessData(FClimateGrid& Grid, const FBiomeSimulationContext& Context, FBiomeJobProgress* Progress, const FClimateKernel& Kernel)
 {
-    // Distance to Ocean and Closest Ocean Cell
-    TArray<float> DistanceMap;
-    TArray<int32> ClosestOceanIndices;
-
-    // Initialize PlanetTime Singleton
-    FPlanetTime& PlanetTime = FPlanetTime::GetInstance();
-    const int32 YearLength = PlanetTime.GetYearLength();
-    const int32 DayLength = PlanetTime.GetDayLengthSeconds();
-    const int32 DayOfYear = PlanetTime.GetDayOfYear();
-
-    // Compute Closest Ocean Cells
-    if (!FindClosestOceanCell(HeightmapData, Width, Height, DistanceMap, ClosestOceanIndices))
+    // Distance to Ocean and OceanToLandVectors, reused if the parser already computed them
+    if (!CalculateDistanceToOcean(Grid))
     {
         return false;
     }
 
-    // Precompute OceanToLandVectors
-    ParallelFor(HeightmapData.Num(), [&](int32 i)
-    {
-        FHeightmapCell& Cell = HeightmapData[i];
-        if (ClosestOceanIndices[i] != -1)
-        {
-            const FHeightmapCell& NearestOceanCell = HeightmapData[ClosestOceanIndices[i]];
-            Cell.OceanToLandVector = FVector2D(
-                Cell.Longitude - NearestOceanCell.Longitude,
-                Cell.Latitude - NearestOceanCell.Latitude
-            ).GetSafeNormal();
-        }
-        else
-        {
-            Cell.OceanToLandVector = FVector2D::ZeroVector;
-        }
-    });
-
-    //Calculate Slope and Aspect for each Heightmap Cell
-    SlopeAndAspect::CalculateSlopeAndAspect(HeightmapData, Width, Height);
+    return PreprocessTerrainAndClimate(Grid, Context, Progress, Kernel);
+}
 
-    // Main ParallelFor Loop
-    ParallelFor(HeightmapData.Num(), [&](int32 i)
+bool Preprocessing::PreprocessTerrainAndClimate(FClimateGrid& Grid, const FBiomeSimulationContext& Context, FBiomeJobProgress* Progress, const FClimateKernel& Kernel)
+{
+    if (Progress)
     {
-        FHeightmapCell& Cell = HeightmapData[i];
-
-        // Calculate Wind Direction and Onshore Wind
-        Cell.WindDirection = UnifiedWindCalculator::CalculateRefinedWind(Cell.Latitude, Cell.Longitude, 0.0f);
-        Cell.IsWindOnshore = WindUtils::IsOnshoreWind(Cell.WindDirection, Cell.OceanToLandVector);
-
-        if(Cell.CellType != ECellType::Ocean)
-        {
-             // Calculate Relative Humidity
-            //Cell.RelativeHumidity = Humidity::CalculateRelativeHumidity(Cell.Latitude, Cell.DistanceToOcean, Cell.Altitude, Cell.IsWindOnshore);
-
-            // Base Temperature Calculation
-            Cell.Temperature = Temperature::CalculateSurfaceTemperature(
-                Cell.Latitude, Cell.Altitude, DayOfYear, /*Cell.RelativeHumidity,*/ PlanetTime, Cell.Slope, Cell.Aspect, Cell.WindDirection.Size());
-
-                    // Adjust Temperature for Ocean Effects
-            Cell.Temperature = OceanTemperature::CalculateOceanTemp(
-                Cell.Temperature, Cell.DistanceToOcean, Cell.Latitude, Cell.Longitude, Cell.FlowDirection);
-
-            // Calculate Precipitation
-            Cell.AnnualPrecipitation = Precipitation::CalculatePrecipitation(
-                Cell.Latitude, Cell.Altitude, Cell.DistanceToOcean, /*Cell.RelativeHumidity,*/ Cell.Slope, Cell.WindDirection, Cell.OceanToLandVector);
-
-                // Adjust Climate Factors
-            WindUtils::AdjustWeatherFactors(
-                Cell.IsWindOnshore, Cell.WindDirection.Size(), Cell.AnnualPrecipitation, 
-                Cell.Temperature, Cell.DistanceToOcean);
-
-        }
-        /*else
-        {
-            // Simplified or predefined values for ocean cells
-            Cell.RelativeHumidity = 85.0f;
-           
-        }*/
-        
-    });
-
-    // Calculate Albedo dynamically after adjusting weather factors
-    Albedo::CalculateDynamicAlbedo(HeightmapData);
+        Progress->BeginStage(TEXT("Preprocessing climate"), Grid.Height);
+    }
 
-    // Adjust Temperature using Albedo
-    ParallelFor(HeightmapData.Num(), [&](int32 i)
-    {
-        FHeightmapCell& Cell = HeightmapData[i];
-        Cell.Temperature -= Cell.Albedo * ALBEDO_EFFECT; // Subtract albedo effect
-    });
+    //Calculate Slope and Aspect for each Heightmap Cell
+    SlopeAndAspect::CalculateSlopeAndAspect(Grid, Context.MathMode);
 
-    return true;
+    // Wind, temperature, ocean moderation, precipitation, weather adjustment and albedo in one pass
+    return Kernel.Run(Grid, Context, Progress);
 }
@@ -1,59 +1,120 @@
 #include "SlopeAndAspect.h"
-#include "HeightmapCell.h"
+#include "TerrainStencil.h"
+#include "ClimateMath.h"
+#include "BiomeISPC.h"
 #include "Math/UnrealMathUtility.h"
-#include "Async/ParallelFor.h"
 
-void SlopeAndAspect::CalculateSlopeAndAspect(
-    TArray<FHeightmapCell>& HeightmapData,
-    int32 Width,
-    int32 Height)
+#if INTEL_ISPC
+#include "SlopeAndAspect.ispc.generated.h"
+#endif
+
+namespace
 {
-    const TArray<FVector2D> NeighborOffsets = {
-        FVector2D(-1, -1), FVector2D(0, -1), FVector2D(1, -1),
-        FVector2D(-1,  0),                  FVector2D(1,  0),
-        FVector2D(-1,  1), FVector2D(0,  1), FVector2D(1,  1)
+    // Per row: the gradient magnitude, and the gradient vector as (Y, -X) for the aspect
+    struct FGradientRow
+    {
+        TArray<float> Magnitude;
+        TArray<float> AspectY;
+        TArray<float> AspectX;
+
+        explicit FGradientRow(int32 Width)
+        {
+            Magnitude.SetNumUninitialized(Width);
+            AspectY.SetNumUninitialized(Width);
+            AspectX.SetNumUninitialized(Width);
+        }
     };
 
-    ParallelFor(HeightmapData.Num(), [&](int32 Index)
+    // Every stencil of one cell; the angles are taken afterwards for a run of cells at once
+    FORCEINLINE void EvaluateCell(int32 X, const FTerrainWindow& Window, const FStencilWeights& Weights,
+        FGradientRow& Gradients, float* CurvatureRow, float* RoughnessRow)
+    {
+        const FVector2f Gradient = FTerrainStencil::HornGradient(Window, Weights);
+        Gradients.Magnitude[X] = FMath::Sqrt(Gradient.X * Gradient.X + Gradient.Y * Gradient.Y);
+        Gradients.AspectY[X] = Gradient.Y;
+        Gradients.AspectX[X] = -Gradient.X;
+        CurvatureRow[X] = FTerrainStencil::Curvature(Window, Weights);
+        RoughnessRow[X] = FTerrainStencil::Roughness(Window);
+    }
+
+    // Slope and aspect in degrees for Num cells starting at column First
+    void ResolveAngles(const FGradientRow& Gradients, int32 First, int32 Num, float* SlopeRow, float* AspectRow, EClimateMathMode MathMode)
     {
-        int32 X = Index % Width;
-        int32 Y = Index / Width;
+        ClimateMath::Atan(&Gradients.Magnitude[First], &SlopeRow[First], Num, MathMode);
+        ClimateMath::Atan2(&Gradients.AspectY[First], &Gradients.AspectX[First], &AspectRow[First], Num, MathMode);
+
+        for (int32 X = First; X < First + Num; ++X)
+        {
+            // Compute slope (in degrees)
+            SlopeRow[X] *= 180.0f / PI;
 
-        FHeightmapCell& Cell = HeightmapData[Index];
-        float CurrentElevation = Cell.Altitude;
+            // Compute aspect (in degrees), normalized to [0, 360); the same as Fmod for [-180, 180]
+            const float Aspect = AspectRow[X] * (180.0f / PI) + 360.0f;
+            AspectRow[X] = Aspect >= 360.0f ? Aspect - 360.0f : Aspect;
+        }
+    }
+}
 
-        float MaxSlope = 0.0f;
-        float GradientX = 0.0f;
-        float GradientY = 0.0f;
+void SlopeAndAspect::CalculateSlopeAndAspect(FClimateGrid& Grid, EClimateMathMode MathMode)
+{
+    const int32 Width = Grid.Width;
+    const int32 Height = Grid.Height;
 
-        for (const FVector2D& Offset : NeighborOffsets)
+    if (Width <= 0 || Height <= 0)
+    {
+        return;
+    }
+
+    TArray<FStencilWeights> RowWeights;
+    FTerrainStencil::CalculateRowWeights(Grid, RowWeights);
+
+#if INTEL_ISPC
+    // The ISPC kernel uses the ISPC standard library's angles, so exact runs stay on the C++ path
+    const bool bUseISPC = BiomeISPC::IsEnabled() && MathMode == EClimateMathMode::Fast;
+#endif
+
+    FTerrainStencil::ForEachTile(Width, Height, [&](int32 FirstRow, int32 LastRow)
+    {
+        FGradientRow Gradients(Width);
+
+        for (int32 Y = FirstRow; Y < LastRow; ++Y)
         {
-            int32 NeighborX = X + Offset.X;
-            int32 NeighborY = Y + Offset.Y;
+            const int32 RowStart = Y * Width;
+            const FStencilRows Rows = FTerrainStencil::GetRows(Grid.Altitude.GetData(), Width, Height, Y);
+            const FStencilWeights& Weights = RowWeights[Y];
 
-            if (NeighborX >= 0 && NeighborX < Width && NeighborY >= 0 && NeighborY < Height)
-            {
-                int32 NeighborIndex = NeighborY * Width + NeighborX;
-                const FHeightmapCell& NeighborCell = HeightmapData[NeighborIndex];
-                float NeighborElevation = NeighborCell.Altitude;
+            float* SlopeRow = &Grid.Slope[RowStart];
+            float* AspectRow = &Grid.Aspect[RowStart];
+            float* CurvatureRow = &Grid.Curvature[RowStart];
+            float* RoughnessRow = &Grid.Roughness[RowStart];
 
-                float Distance = Offset.Size();
-                float Gradient = (NeighborElevation - CurrentElevation) / Distance;
+            auto CellFunction = [&](int32 X, const FTerrainWindow& Window)
+            {
+                EvaluateCell(X, Window, Weights, Gradients, CurvatureRow, RoughnessRow);
+            };
 
-                // Update X and Y gradients
-                GradientX += Gradient * Offset.X;
-                GradientY += Gradient * Offset.Y;
+#if INTEL_ISPC
+            if (bUseISPC)
+            {
+                // ISPC does the interior, the border columns go through the same stencils as below
+                ispc::CalculateTerrainRowInterior(Rows.Above, Rows.Center, Rows.Below, Width,
+                    Weights.HornX, Weights.HornY, Weights.CurvatureX, Weights.CurvatureY,
+                    SlopeRow, AspectRow, CurvatureRow, RoughnessRow);
 
-                // Calculate slope
-                MaxSlope = FMath::Max(MaxSlope, FMath::Abs(Gradient));
+                FTerrainStencil::ForEachBorderCell(Rows, CellFunction);
+                ResolveAngles(Gradients, 0, 1, SlopeRow, AspectRow, MathMode);
+                if (Width > 1)
+                {
+                    ResolveAngles(Gradients, Width - 1, 1, SlopeRow, AspectRow, MathMode);
+                }
+                continue;
             }
-        }
+#endif
 
-        // Compute slope (in degrees)
-        Cell.Slope = FMath::Atan(MaxSlope) * (180.0f / PI);
+            FTerrainStencil::ForEachCell(Rows, CellFunction);
 
-        // Compute aspect (in degrees)
-        float Aspect = FMath::Atan2(GradientY, -GradientX) * (180.0f / PI);
-        Cell.Aspect = FMath::Fmod(Aspect + 360.0f, 360.0f); // Normalize to [0, 360]
+            // Angles for the whole row at once, straight into the grid
+            ResolveAngles(Gradients, 0, Width, SlopeRow, AspectRow, MathMode);
+        }
     });
 }
@@ -30,13 +30,26 @@ float Temperature::CalculateSurfaceTemperature(
     float Slope,
     float Aspect,
     float WindSpeed)
+{
+    return CalculateSurfaceTemperatureFromInsolation(CalculateSolarInsolation(Latitude), Altitude, Slope, Aspect, WindSpeed);
+}
+
+float Temperature::CalculateSolarInsolation(float Latitude)
 {
     // Solar declination angle based on day of year
     // Currently fixed for mid-summer. Implement Cos function for seasonal variations later
     // bool IsSummer = true;
     float DeclinationAngle = 23.5f; //* FMath::Cos(2.0f * PI * (DayOfYear / PlanetTime.GetYearLength()));
-    float SolarInsolation = FMath::Max(0.0f, FMath::Cos(FMath::DegreesToRadians(Latitude - DeclinationAngle)));
+    return FMath::Max(0.0f, FMath::Cos(FMath::DegreesToRadians(Latitude - DeclinationAngle)));
+}
 
+float Temperature::CalculateSurfaceTemperatureFromInsolation(
+    float SolarInsolation,
+    float Altitude,
+    float Slope,
+    float Aspect,
+    float WindSpeed)
+{
     // Base temperature at sea level
     float SurfaceTemp = TEMP_BASE_EQUATOR * SolarInsolation;
 
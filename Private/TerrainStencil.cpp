@@ -0,0 +1,30 @@
+#include "TerrainStencil.h"
+
+// Meters per degree of latitude, and of longitude on the equator
+static constexpr float METERS_PER_DEGREE = 111320.0f;
+
+// Keeps the column spacing finite on rows at the poles
+static constexpr float MIN_LONGITUDE_SCALE = 0.01f;
+
+void FTerrainStencil::CalculateRowWeights(const FClimateGrid& Grid, TArray<FStencilWeights>& OutWeights)
+{
+    OutWeights.SetNum(Grid.Height);
+
+    if (Grid.Resolution.X <= 0.0 || Grid.Resolution.Y <= 0.0)
+    {
+        for (FStencilWeights& Weights : OutWeights)
+        {
+            Weights = FStencilWeights::FromSpacing(1.0f, 1.0f);
+        }
+        return;
+    }
+
+    const float SpacingY = METERS_PER_DEGREE / static_cast<float>(Grid.Resolution.X);
+    const float EquatorSpacingX = METERS_PER_DEGREE / static_cast<float>(Grid.Resolution.Y);
+
+    for (int32 Y = 0; Y < Grid.Height; ++Y)
+    {
+        const float LongitudeScale = FMath::Max(FMath::Cos(FMath::DegreesToRadians(Grid.RowLatitude[Y])), MIN_LONGITUDE_SCALE);
+        OutWeights[Y] = FStencilWeights::FromSpacing(EquatorSpacingX * LongitudeScale, SpacingY);
+    }
+}
@@ -0,0 +1,362 @@
+#include "TiledBiomePipeline.h"
+#include "Async/ParallelFor.h"
+#include "BiomeCalculator.h"
+#include "DistanceToOcean.h"
+#include "ClimateGrid.h"
+#include "Altitude.h"
+#include "HeightmapParser.h"
+#include "MappedHeightmapFile.h"
+#include "Preprocessing.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+
+// Tiles are rounded down to a multiple of this many cells
+static constexpr int32 TILE_ALIGNMENT = 64;
+
+// Bytes per cell of a strip of the ocean distance pre-pass: sample, ocean mask, column pass and nearest ocean cell
+static constexpr int64 OCEAN_STRIP_BYTES_PER_CELL = sizeof(float) + sizeof(uint8) + sizeof(int32) + sizeof(FIntPoint);
+
+namespace
+{
+    /** Describes a plane in the same format ReadMetadataFromFile understands. */
+    bool WritePlaneHeader(const FString& FilePath, int32 Width, int32 Height, int32 BitDepth)
+    {
+        const FString Metadata = FString::Printf(TEXT("Width: %d\nHeight: %d\nBitDepth: %d\n"), Width, Height, BitDepth);
+        return FFileHelper::SaveStringToFile(Metadata, *FPaths::ChangeExtension(FilePath, TEXT("hdr")));
+    }
+
+    /** A full-size result plane written to disk row by row as tiles complete. */
+    struct FTileOutputPlane
+    {
+        FString FileName;
+        int32 BytesPerCell = 0;
+        TUniquePtr<IFileHandle> Handle;
+    };
+
+    bool OpenOutputPlane(FTileOutputPlane& Plane, const FString& Directory, int32 Width, int32 Height, int32 BitDepth)
+    {
+        const FString FilePath = FPaths::Combine(Directory, Plane.FileName);
+        Plane.Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath));
+        if (!Plane.Handle.IsValid())
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to open tile output file: %s"), *FilePath);
+            return false;
+        }
+
+        return WritePlaneHeader(FilePath, Width, Height, BitDepth);
+    }
+
+    bool WriteRow(FTileOutputPlane& Plane, int32 FullWidth, int32 X, int32 Y, const void* RowData, int32 NumCells)
+    {
+        const int64 Offset = (static_cast<int64>(Y) * FullWidth + X) * Plane.BytesPerCell;
+        return Plane.Handle->Seek(Offset) &&
+               Plane.Handle->Write(static_cast<const uint8*>(RowData), static_cast<int64>(NumCells) * Plane.BytesPerCell);
+    }
+}
+
+bool FTiledBiomePipeline::WritePlane(const FString& Directory, const FString& FileName, const void* Data, int32 Width, int32 Height, int32 BitDepth)
+{
+    const FString FilePath = FPaths::Combine(Directory, FileName);
+    const TArrayView64<const uint8> Bytes(static_cast<const uint8*>(Data), static_cast<int64>(Width) * Height * (BitDepth / 8));
+
+    if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to write output plane: %s"), *FilePath);
+        return false;
+    }
+
+    return WritePlaneHeader(FilePath, Width, Height, BitDepth);
+}
+
+bool FTiledBiomePipeline::WriteBiomePalette(const FString& Directory)
+{
+    FString Palette = "Id,Name,Color\n";
+    for (int32 Index = 0; Index < FBiomeRegistry::Num(); ++Index)
+    {
+        const FBiomeDefinition& Biome = FBiomeRegistry::Get(static_cast<EBiomeId>(Index));
+        Palette += FString::Printf(TEXT("%d,%s,#%s\n"), Index, *Biome.Name, *Biome.Color.ToHex());
+    }
+    return FFileHelper::SaveStringToFile(Palette, *FPaths::Combine(Directory, TEXT("BiomePalette.csv")));
+}
+
+int64 FTiledBiomePipeline::GetEstimatedBytesPerCell()
+{
+    // Climate grid planes, plus the sample plane and the nearest ocean cells read from the pre-pass
+    return FClimateGrid::GetBytesPerCell() + sizeof(float) + sizeof(FIntPoint);
+}
+
+int32 FTiledBiomePipeline::ComputeTileSize(const FTiledPipelineSettings& Settings)
+{
+    const int64 MaxPaddedCells = Settings.MemoryBudgetBytes / GetEstimatedBytesPerCell();
+    const int32 MaxPaddedSize = static_cast<int32>(FMath::Sqrt(static_cast<double>(MaxPaddedCells)));
+    int32 MaxTileSize = ((MaxPaddedSize - 2 * Settings.HaloSize) / TILE_ALIGNMENT) * TILE_ALIGNMENT;
+
+    if (MaxTileSize <= 0)
+    {
+        return 0;
+    }
+
+    return Settings.TileSize > 0 ? FMath::Min(Settings.TileSize, MaxTileSize) : MaxTileSize;
+}
+
+bool FTiledBiomePipeline::Run(
+    const FString& FilePath,
+    const FBiomeSimulationContext& Context,
+    const FTiledPipelineSettings& Settings,
+    FString& OutSummary)
+{
+    const FInputParameters& InputParams = Context.InputParams;
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 BitDepth = 0;
+
+    // Row reader for the source; raw files are streamed, images are decoded once
+    FMappedHeightmapFile MappedFile;
+    TArray<float> ImageSamples;
+    TFunction<void(int32, int32, int32, float*)> ReadRow;
+
+    const FString FileExtension = FPaths::GetExtension(FilePath).ToLower();
+    if (FileExtension == TEXT("r16") || FileExtension == TEXT("r32") || FileExtension == TEXT("raw"))
+    {
+        BitDepth = (FileExtension == TEXT("r16")) ? 16 : 32;
+        if (!UHeightmapParser::OpenRawHeightmap(FilePath, MappedFile, Width, Height, BitDepth))
+        {
+            return false;
+        }
+
+        if (MappedFile.GetNumSamples(BitDepth) < static_cast<int64>(Width) * Height)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Raw heightmap is smaller than its dimensions: %dx%d"), Width, Height);
+            return false;
+        }
+
+        const bool bBigEndian = MappedFile.IsBigEndian(BitDepth);
+        ReadRow = [&MappedFile, BitDepth, bBigEndian, &Width](int32 Y, int32 X, int32 Count, float* OutSamples)
+        {
+            MappedFile.DecodeSamples(BitDepth, bBigEndian, static_cast<int64>(Y) * Width + X, Count, OutSamples);
+        };
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Image heightmaps cannot be streamed; decoding %s as a single plane."), *FilePath);
+        if (!UHeightmapParser::LoadHeightmap(FilePath, ImageSamples, Width, Height, BitDepth) ||
+            ImageSamples.Num() != Width * Height)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to load heightmap: %s"), *FilePath);
+            return false;
+        }
+
+        ReadRow = [&ImageSamples, &Width](int32 Y, int32 X, int32 Count, float* OutSamples)
+        {
+            FMemory::Memcpy(OutSamples, &ImageSamples[Y * Width + X], Count * sizeof(float));
+        };
+    }
+
+    if (Width <= 0 || Height <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid heightmap dimensions: %dx%d"), Width, Height);
+        return false;
+    }
+
+    const int32 TileSize = ComputeTileSize(Settings);
+    if (TileSize <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Memory budget of %lld bytes cannot hold a tile with a %d cell halo."),
+            Settings.MemoryBudgetBytes, Settings.HaloSize);
+        return false;
+    }
+
+    float MinLongitude = 0.0f;
+    float MaxLongitude = 0.0f;
+    UHeightmapParser::EstimateLongitudeRange(
+        InputParams.SouthernLatitude,
+        InputParams.NorthernLatitude,
+        Width,
+        Height,
+        InputParams.CentralLongitude,
+        MinLongitude,
+        MaxLongitude);
+
+    // Open the full-size output planes
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.CreateDirectoryTree(*Settings.OutputDirectory))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to create tile output directory: %s"), *Settings.OutputDirectory);
+        return false;
+    }
+
+    FTileOutputPlane BiomePlane{ TEXT("BiomeId.r8"), sizeof(EBiomeId) };
+    FTileOutputPlane AltitudePlane{ TEXT("Altitude.r32"), sizeof(float) };
+    FTileOutputPlane TemperaturePlane{ TEXT("Temperature.r32"), sizeof(float) };
+    FTileOutputPlane PrecipitationPlane{ TEXT("Precipitation.r32"), sizeof(float) };
+
+    if (!WriteBiomePalette(Settings.OutputDirectory) ||
+        !OpenOutputPlane(BiomePlane, Settings.OutputDirectory, Width, Height, 8) ||
+        !OpenOutputPlane(AltitudePlane, Settings.OutputDirectory, Width, Height, 32) ||
+        !OpenOutputPlane(TemperaturePlane, Settings.OutputDirectory, Width, Height, 32) ||
+        !OpenOutputPlane(PrecipitationPlane, Settings.OutputDirectory, Width, Height, 32))
+    {
+        return false;
+    }
+
+    const int32 TilesX = FMath::DivideAndRoundUp(Width, TileSize);
+    const int32 TilesY = FMath::DivideAndRoundUp(Height, TileSize);
+    UE_LOG(LogTemp, Log, TEXT("Tiled pipeline: %dx%d heightmap, %dx%d tiles of %d cells with a %d cell halo."),
+        Width, Height, TilesX, TilesY, TileSize, Settings.HaloSize);
+
+    // Nearest ocean cells over the whole heightmap, so tiles see coasts beyond their halo
+    const FString OceanCellsPath = FPaths::Combine(Settings.OutputDirectory, TEXT("ClosestOcean.tmp"));
+    ON_SCOPE_EXIT
+    {
+        PlatformFile.DeleteFile(*OceanCellsPath);
+    };
+
+    TArray<float> TileSamples;
+    const auto ReadOceanMask = [&](int32 FirstRow, int32 NumRows, uint8* OutMask)
+    {
+        TileSamples.SetNumUninitialized(NumRows * Width);
+        ParallelFor(NumRows, [&](int32 Row)
+        {
+            float* RowAltitude = TileSamples.GetData() + Row * Width;
+            uint8* RowMask = OutMask + Row * Width;
+            ReadRow(FirstRow + Row, 0, Width, RowAltitude);
+            CalculateAltitudes(RowAltitude, Width, InputParams.MinimumAltitude, InputParams.MaximumAltitude, RowAltitude);
+
+            // The cells CalculateDistanceToOcean treats as ocean
+            for (int32 X = 0; X < Width; ++X)
+            {
+                RowMask[X] = (RowAltitude[X] <= InputParams.SeaLevel && CalculateOceanDepth(InputParams.SeaLevel, RowAltitude[X]) > 0.0f) ? 1 : 0;
+            }
+        });
+    };
+
+    if (!FindClosestOceanCellsToFile(Width, Height, Settings.MemoryBudgetBytes / OCEAN_STRIP_BYTES_PER_CELL, ReadOceanMask,
+                                     FPaths::Combine(Settings.OutputDirectory, TEXT("ClosestOceanColumns.tmp")), OceanCellsPath))
+    {
+        return false;
+    }
+
+    TUniquePtr<IFileHandle> OceanCellsFile(PlatformFile.OpenRead(*OceanCellsPath));
+    if (!OceanCellsFile.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to open the nearest ocean cells: %s"), *OceanCellsPath);
+        return false;
+    }
+
+    TArray<float> FullRowLatitude;
+    TArray<float> FullColumnLongitude;
+    FullRowLatitude.SetNumUninitialized(Height);
+    FullColumnLongitude.SetNumUninitialized(Width);
+    for (int32 Y = 0; Y < Height; ++Y)
+    {
+        FullRowLatitude[Y] = UHeightmapParser::GetRowLatitude(InputParams, Y, Height);
+    }
+    for (int32 X = 0; X < Width; ++X)
+    {
+        FullColumnLongitude[X] = UHeightmapParser::GetColumnLongitude(MinLongitude, MaxLongitude, X, Width);
+    }
+
+    // Rooted for the run rather than configuring the class default object
+    UBiomeCalculator* Calculator = NewObject<UBiomeCalculator>();
+    Calculator->AddToRoot();
+    ON_SCOPE_EXIT
+    {
+        Calculator->RemoveFromRoot();
+    };
+
+    Calculator->LookupTableSettings = Settings.LookupTable;
+    Calculator->PrepareLookupTable(InputParams);
+    FBiomeStatistics Statistics;
+
+    TArray<FIntPoint> TileOceanCells;
+    FClimateGrid TileGrid;
+
+    for (int32 TileY = 0; TileY < TilesY; ++TileY)
+    {
+        for (int32 TileX = 0; TileX < TilesX; ++TileX)
+        {
+            const FIntRect Interior(
+                TileX * TileSize,
+                TileY * TileSize,
+                FMath::Min((TileX + 1) * TileSize, Width),
+                FMath::Min((TileY + 1) * TileSize, Height));
+
+            const FIntRect Padded(
+                FMath::Max(Interior.Min.X - Settings.HaloSize, 0),
+                FMath::Max(Interior.Min.Y - Settings.HaloSize, 0),
+                FMath::Min(Interior.Max.X + Settings.HaloSize, Width),
+                FMath::Min(Interior.Max.Y + Settings.HaloSize, Height));
+
+            const int32 PaddedWidth = Padded.Width();
+            const int32 PaddedHeight = Padded.Height();
+
+            // Parse: decode the padded region's samples and build its grid
+            TileSamples.SetNumUninitialized(PaddedWidth * PaddedHeight);
+            ParallelFor(PaddedHeight, [&](int32 Row)
+            {
+                ReadRow(Padded.Min.Y + Row, Padded.Min.X, PaddedWidth, TileSamples.GetData() + Row * PaddedWidth);
+            });
+
+            UHeightmapParser::BuildClimateGrid(TileSamples.GetData(), Padded, Width, Height,
+                InputParams, MinLongitude, MaxLongitude, TileGrid);
+
+            // Nearest ocean cells of the padded region, from the pre-pass
+            TileOceanCells.SetNumUninitialized(PaddedWidth * PaddedHeight);
+            bool bOceanCellsRead = true;
+            for (int32 Row = 0; Row < PaddedHeight && bOceanCellsRead; ++Row)
+            {
+                const int64 Offset = (static_cast<int64>(Padded.Min.Y + Row) * Width + Padded.Min.X) * sizeof(FIntPoint);
+                bOceanCellsRead = OceanCellsFile->Seek(Offset) &&
+                                  OceanCellsFile->Read(reinterpret_cast<uint8*>(TileOceanCells.GetData() + Row * PaddedWidth), PaddedWidth * sizeof(FIntPoint));
+            }
+
+            if (!bOceanCellsRead)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Failed to read the nearest ocean cells of tile (%d, %d)."), TileX, TileY);
+                return false;
+            }
+
+            ApplyClosestOceanCells(TileGrid, Padded, TileOceanCells.GetData(), FullRowLatitude, FullColumnLongitude);
+
+            // Ocean fields come from the whole heightmap and the terrain stencils see the halo,
+            // so tile edges match the in-core result
+            if (!Preprocessing::PreprocessTerrainAndClimate(TileGrid, Context))
+            {
+                UE_LOG(LogTemp, Error, TEXT("Failed to preprocess tile (%d, %d)."), TileX, TileY);
+                return false;
+            }
+
+            // Classify only the interior so each cell is classified and counted once
+            const FIntRect InteriorInTile = Interior - Padded.Min;
+            Calculator->ClassifyGrid(Context, MinLongitude, MaxLongitude, TileGrid, InteriorInTile, Statistics);
+
+            // Write the interior rows of every plane straight from the grid
+            const int32 InteriorWidth = Interior.Width();
+            bool bWritten = true;
+
+            for (int32 Row = InteriorInTile.Min.Y; Row < InteriorInTile.Max.Y && bWritten; ++Row)
+            {
+                const int32 RowStart = Row * PaddedWidth + InteriorInTile.Min.X;
+                const int32 Y = Padded.Min.Y + Row;
+
+                bWritten &= WriteRow(BiomePlane, Width, Interior.Min.X, Y, &TileGrid.BiomeId[RowStart], InteriorWidth);
+                bWritten &= WriteRow(AltitudePlane, Width, Interior.Min.X, Y, &TileGrid.Altitude[RowStart], InteriorWidth);
+                bWritten &= WriteRow(TemperaturePlane, Width, Interior.Min.X, Y, &TileGrid.Temperature[RowStart], InteriorWidth);
+                bWritten &= WriteRow(PrecipitationPlane, Width, Interior.Min.X, Y, &TileGrid.AnnualPrecipitation[RowStart], InteriorWidth);
+            }
+
+            if (!bWritten)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Failed to write results for tile (%d, %d)."), TileX, TileY);
+                return false;
+            }
+
+            UE_LOG(LogTemp, Log, TEXT("Tiled pipeline: finished tile %d of %d."), TileY * TilesX + TileX + 1, TilesX * TilesY);
+        }
+    }
+
+    OutSummary = UBiomeCalculator::FormatBiomeSummary(Statistics);
+    return FFileHelper::SaveStringToFile(Statistics.FormatLatitudeBandsCSV(), *FPaths::Combine(Settings.OutputDirectory, TEXT("BiomeLatitudeBands.csv")));
+}
@@ -2,8 +2,12 @@
 
 bool WindUtils::IsOnshoreWind(FVector2D WindDirection, FVector2D OceanToLandVector)
 {
-    float DotProduct = FVector2D::DotProduct(WindDirection.GetSafeNormal(), OceanToLandVector.GetSafeNormal());
-    return DotProduct > 0.0f; // Onshore if dot product is positive
+    // Normalizing does not change the sign of the dot product, only GetSafeNormal's zero for tiny vectors matters
+    if (WindDirection.SizeSquared() <= SMALL_NUMBER || OceanToLandVector.SizeSquared() <= SMALL_NUMBER)
+    {
+        return false;
+    }
+    return FVector2D::DotProduct(WindDirection, OceanToLandVector) > 0.0f; // Onshore if dot product is positive
 }
 
 void WindUtils::AdjustWeatherFactors(bool IsOnshore, float WindStrength, float& Precipitation, float& Temperature, float DistanceToOcean)
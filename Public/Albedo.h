@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ClimateGrid.h"
 
 class BIOMEMAPPER_API Albedo
 {
@@ -15,6 +16,9 @@ public:
     // Adjust albedo based on precipitation and vegetation cover
     static float AdjustAlbedoForPrecipitation(float Albedo, float Precipitation);
 
+    // Compute dynamic albedo of one cell from its latitude's base albedo; cells without a distance to the ocean keep their current albedo
+    static float CalculateCellAlbedo(float CurrentAlbedo, float BaseAlbedo, float DistanceToOcean, float Temperature, float Precipitation);
+
     // Compute dynamic albedo based on environmental factors
-    static void CalculateDynamicAlbedo(TArray<FHeightmapCell>& HeightmapData);
+    static void CalculateDynamicAlbedo(FClimateGrid& Grid);
 };
\ No newline at end of file
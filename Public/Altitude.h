@@ -3,13 +3,23 @@
 #include "CoreMinimal.h"
 
 /**
- * Calculate altitude based on pixel value.
- * @param PixelValue - The grayscale pixel value from the heightmap (0-255).
+ * Calculate altitude based on a normalized heightmap sample.
+ * @param NormalizedValue - The heightmap sample at full source precision, 0 to 1; clamped.
  * @param MinAltitude - The minimum altitude for the heightmap.
  * @param MaxAltitude - The maximum altitude for the heightmap.
  * @return Calculated altitude.
  */
-float CalculateAltitude(uint8 PixelValue, float MinAltitude, float MaxAltitude);
+float CalculateAltitude(float NormalizedValue, float MinAltitude, float MaxAltitude);
+
+/**
+ * Calculate the altitude of a run of normalized heightmap samples in one vectorizable pass.
+ * @param NormalizedSamples - The heightmap samples at full source precision, 0 to 1; clamped.
+ * @param NumSamples - Number of samples.
+ * @param MinAltitude - The minimum altitude for the heightmap.
+ * @param MaxAltitude - The maximum altitude for the heightmap.
+ * @param OutAltitudes - Receives one altitude per sample.
+ */
+void CalculateAltitudes(const float* NormalizedSamples, int32 NumSamples, float MinAltitude, float MaxAltitude, float* OutAltitudes);
 
 /**
  * Calculate ocean depth based on sea level and raw altitude.
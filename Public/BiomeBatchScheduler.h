@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BiomeDataExporter.h"
+#include "BiomeLookupTable.h"
+#include "BiomeSimulationContext.h"
+
+/**
+ * One heightmap of a batch, with its own inputs and results.
+ */
+struct BIOMEMAPPER_API FBiomeBatchJob
+{
+    /** Heightmap to process. */
+    FString HeightmapPath;
+
+    /** Directory the job's planes, palette, statistics and summary are written to. */
+    FString OutputDirectory;
+
+    /** Planet, time and input parameters for this heightmap. */
+    FBiomeSimulationContext Context;
+
+    /** Set by CollectJobs if the job's manifest line was invalid; the job fails without running. */
+    bool bRejected = false;
+
+    /** Set once the job has run. */
+    bool bSucceeded = false;
+
+    /** Detected biomes, their occurrence counts and area coverage. */
+    FString Summary;
+
+    /** Wall-clock time from the start of loading to the last file written. */
+    double Seconds = 0.0;
+};
+
+/**
+ * Settings shared by every job of a batch.
+ */
+struct BIOMEMAPPER_API FBiomeBatchSettings
+{
+    /** Jobs in their climate and classification stages at the same time. */
+    int32 MaxConcurrentJobs = 2;
+
+    /**
+     * Upper bound on the estimated working memory of all running jobs, in bytes.
+     * A job larger than the budget still runs, but only on its own.
+     */
+    int64 MemoryBudgetBytes = 4096ll * 1024 * 1024;
+
+    /** Compiled classification mode, for every job. */
+    FBiomeLookupTableSettings LookupTable;
+
+    /** Per-cell data export for each job; relative paths are resolved against the job's output directory. */
+    FBiomeDataExportSettings Export;
+};
+
+/**
+ * Processes many heightmaps concurrently in memory.
+ * The calling thread loads and decodes heightmaps one at a time, so the next map's I/O
+ * overlaps the climate stages of the running ones. Running jobs are processed on the thread
+ * pool and their parallel passes share the task graph's workers. A job is admitted from its
+ * dimensions, once the concurrency limit and memory budget allow it, and only then decoded,
+ * so the samples of the map being loaded count against the budget too. Every job runs with
+ * its own context.
+ */
+class BIOMEMAPPER_API FBiomeBatchScheduler
+{
+public:
+    /**
+     * Builds the job list from a directory of heightmaps or a manifest file.
+     * Manifest lines are "Path[,NorthLat,SouthLat,CentralLon,MinAlt,MaxAlt,SeaLevel,YearLength,DayLength,DayOfYear]";
+     * omitted values come from DefaultContext, relative paths are relative to the manifest, and
+     * lines starting with # are ignored. Lines with non-numeric or out-of-range values are logged
+     * and their jobs rejected.
+     * @param DirectoryOrManifest - Directory to scan for .r16, .r32, .raw, .png and .jpg files, or a manifest file.
+     * @param DefaultContext - Planet, time and input parameters for jobs that do not override them.
+     * @param OutputRoot - Each job writes into OutputRoot/<heightmap name>.
+     * @param OutJobs - Jobs found, in file or manifest order.
+     * @return False if the source could not be read or held no heightmaps.
+     */
+    static bool CollectJobs(
+        const FString& DirectoryOrManifest,
+        const FBiomeSimulationContext& DefaultContext,
+        const FString& OutputRoot,
+        TArray<FBiomeBatchJob>& OutJobs);
+
+    /**
+     * Runs every job and fills in its results. Must be called on the game thread.
+     * @param Jobs - Jobs to run.
+     * @param Settings - Concurrency, memory and output settings.
+     * @return True if every job succeeded.
+     */
+    static bool Run(TArray<FBiomeBatchJob>& Jobs, const FBiomeBatchSettings& Settings);
+
+    /**
+     * Estimated working memory of an in-core job, in bytes: the decoded samples plus the climate grid.
+     */
+    static int64 EstimateJobBytes(int32 Width, int32 Height);
+};
@@ -2,11 +2,18 @@
 
 #include "CoreMinimal.h"
 #include "HeightmapCell.h"
+#include "ClimateGrid.h"
+#include "BiomeRegistry.h"
+#include "BiomeLookupTable.h"
+#include "BiomeDataExporter.h"
+#include "BiomeStatistics.h"
 #include "BiomeInputShared.h"
-#include "PlanetTime.h"
+#include "BiomeSimulationContext.h"
 #include "UObject/Object.h"
 #include "BiomeCalculator.generated.h"
 
+class FBiomeJobProgress;
+
 /**
  * Class responsible for calculating biome classifications.
  */
@@ -27,28 +34,92 @@ public:
 
     /**
      * Calculate biomes for an entire heightmap input.
-     * @param InputParams - Struct containing the input variables
+     * @param Context - The run's planet, time and input parameters
      * @param MinLongitude - Calculated minimum longitude (float).
-     * @param MaxLongitude - Calculated maximum longitude (float).     * 
-     * @param HeightmapData - The heightmap data array.
-     * @param PlanetTime - The planetary time information.
+     * @param MaxLongitude - Calculated maximum longitude (float).
+     * @param Grid - The climate grid; the biome plane is written.
+     * @param Progress - Optional progress to report stages to; the run stops early if it is cancelled.
      * @return The calculated biome data as a string.
      */
-    
-    UFUNCTION(BlueprintCallable, Category = "Biome Calculator")
     FString CalculateBiomeFromInput(
-        FInputParameters& InputParams,             
+        const FBiomeSimulationContext& Context,
         float MinLongitude, // Use calculated Min Longitude
         float MaxLongitude, // Use calculated Max Longitude        
-        TArray<FHeightmapCell>& HeightmapData);
+        FClimateGrid& Grid,
+        FBiomeJobProgress* Progress = nullptr);
+
+    /**
+     * Classify every land cell of a grid region inside the input ranges and gather biome statistics.
+     * Unlike CalculateBiomeFromInput this has no side effects beyond the grid itself.
+     * @param Context - The run's input parameters, and its math mode for the scoring path.
+     * @param MinLongitude - Minimum longitude of the heightmap.
+     * @param MaxLongitude - Maximum longitude of the heightmap.
+     * @param Grid - The climate grid; the biome plane is written.
+     * @param Region - Cells of the grid to classify.
+     * @param InOutStatistics - Biome counts and coverage, accumulated across calls.
+     * @param Progress - Optional progress; reported per batch, and remaining batches are skipped once cancelled.
+     */
+    void ClassifyGrid(
+        const FBiomeSimulationContext& Context,
+        float MinLongitude,
+        float MaxLongitude,
+        FClimateGrid& Grid,
+        const FIntRect& Region,
+        FBiomeStatistics& InOutStatistics,
+        FBiomeJobProgress* Progress = nullptr);
+
+    /**
+     * Compiles the classification lookup table for a run if LookupTableSettings enables it.
+     * CalculateBiomeFromInput calls this itself; callers of ClassifyGrid call it once per run.
+     * @param InputParams - Struct containing the input variables; bounds the latitude and altitude axes.
+     */
+    void PrepareLookupTable(const FInputParameters& InputParams);
+
+    /**
+     * Formats biome occurrence counts and area coverage as the summary shown to the user.
+     * @param Statistics - Statistics gathered by ClassifyGrid.
+     * @return One line per detected biome.
+     */
+    static FString FormatBiomeSummary(const FBiomeStatistics& Statistics);
 
     /**
      * Filter biome candidates based on environmental parameters.
      * @param Temperature - Temperature after adjustments.
      * @param AnnualPrecipitation - Total precipitation.
-     * @return Array of biome candidates.
+     * @return Names of the biome candidates.
      */
     UFUNCTION(BlueprintCallable, category = "Biome Calculator")
     TArray<FString> FilterBiomeCandidates(float Temperature, float AnnualPrecipitation, float Latitude, float Altitude/*, float Humidity*/);
 
+    /**
+     * Filter biome candidates based on environmental parameters.
+     * @param Temperature - Temperature after adjustments.
+     * @param AnnualPrecipitation - Total precipitation.
+     * @return Mask of the biome candidates, zero if none matched.
+     */
+    static FBiomeCandidateMask FilterBiomeCandidateMask(float Temperature, float AnnualPrecipitation, float Latitude, float Altitude);
+
+    /**
+     * Every value FilterBiomeCandidateMask compares against, per input.
+     * Latitude thresholds are magnitudes; the latitude bands are symmetric about the equator.
+     */
+    static void GetCandidateThresholds(
+        TArray<float>& OutTemperature,
+        TArray<float>& OutPrecipitation,
+        TArray<float>& OutLatitude,
+        TArray<float>& OutAltitude);
+
+    /** Settings for the compiled classification mode. */
+    FBiomeLookupTableSettings LookupTableSettings;
+
+    /** Settings for the per-cell data export, and the latitude band statistics written with it, after each calculation. */
+    FBiomeDataExportSettings ExportSettings;
+
+private:
+    /** Filters the candidates for a set of climate values and picks the most probable biome. */
+    static EBiomeId ResolveBiome(float Temperature, float AnnualPrecipitation, float Latitude, float Altitude, float Slope, float Aspect);
+
+    /** Table compiled by PrepareLookupTable, empty when the compiled mode is off. */
+    FBiomeLookupTable LookupTable;
+
 };
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimateGrid.h"
+
+/**
+ * Per-cell fields the exporter can write, in CSV column order.
+ */
+enum class EBiomeDataColumn : uint32
+{
+    None                    = 0,
+    CellIndex               = 1 << 0,
+    Latitude                = 1 << 1,
+    Longitude               = 1 << 2,
+    Altitude                = 1 << 3,
+    Temperature             = 1 << 4,
+    Precipitation           = 1 << 5,
+    Slope                   = 1 << 6,
+    Aspect                  = 1 << 7,
+    Biome                   = 1 << 8,
+    DistanceToOcean         = 1 << 9,
+    Albedo                  = 1 << 10,
+    ClosestOceanTemperature = 1 << 11,
+    Curvature               = 1 << 12,
+    Roughness               = 1 << 13,
+
+    /** The columns of the original BiomeDataLog.csv. */
+    Default = CellIndex | Latitude | Longitude | Altitude | Temperature | Precipitation | Slope | Aspect | Biome,
+    All = Default | DistanceToOcean | Albedo | ClosestOceanTemperature | Curvature | Roughness
+};
+ENUM_CLASS_FLAGS(EBiomeDataColumn);
+
+enum class EBiomeDataFormat : uint8
+{
+    /** One text row per cell; biomes by name. */
+    CSV,
+
+    /** One binary file per field with a small header; biomes by ID. Loads back with LoadColumnar. */
+    Columnar
+};
+
+/**
+ * Settings for exporting per-cell climate and biome data.
+ */
+struct BIOMEMAPPER_API FBiomeDataExportSettings
+{
+    /** Export after each calculation. Off by default, since a CSV of a large map takes minutes and gigabytes. */
+    bool bEnabled = false;
+
+    EBiomeDataFormat Format = EBiomeDataFormat::CSV;
+
+    EBiomeDataColumn Columns = EBiomeDataColumn::Default;
+
+    /**
+     * CSV file or columnar directory. Relative paths and the empty default
+     * (BiomeDataLog.csv or BiomeData/) are resolved against the caller's output directory.
+     */
+    FString OutputPath;
+
+    /** CSV only: skip cells at zero altitude, as the original log did. */
+    bool bSkipZeroAltitude = true;
+};
+
+/**
+ * Writes climate grids as CSV or as binary columns.
+ */
+class BIOMEMAPPER_API FBiomeDataExporter
+{
+public:
+    /**
+     * Exports a grid as configured.
+     * @param Grid - The climate grid.
+     * @param Settings - Format, columns and path.
+     * @param DefaultDirectory - Directory that relative and default output paths are resolved against.
+     * @return True if the export was written.
+     */
+    static bool Export(const FClimateGrid& Grid, const FBiomeDataExportSettings& Settings, const FString& DefaultDirectory);
+
+    /** The CSV file or columnar directory Export writes to. */
+    static FString ResolveOutputPath(const FBiomeDataExportSettings& Settings, const FString& DefaultDirectory);
+
+    /** The directory Export writes into, for files that accompany the export. */
+    static FString ResolveOutputDirectory(const FBiomeDataExportSettings& Settings, const FString& DefaultDirectory);
+
+    /**
+     * Writes the selected columns as CSV. Rows are formatted in parallel chunks and
+     * streamed to the file in order, so memory stays bounded by a few chunks.
+     */
+    static bool ExportCSV(const FClimateGrid& Grid, EBiomeDataColumn Columns, bool bSkipZeroAltitude, const FString& FilePath);
+
+    /**
+     * Writes each selected field to Directory/<Column>.bmc: a 16 byte header followed by the raw plane.
+     * Latitude and longitude are written per row and per column; CellIndex is implicit and skipped.
+     */
+    static bool ExportColumnar(const FClimateGrid& Grid, EBiomeDataColumn Columns, const FString& Directory);
+
+    /**
+     * Loads the columns found in a directory written by ExportColumnar. Planes without a file keep their defaults.
+     * @param Directory - Directory holding the .bmc files.
+     * @param OutGrid - Grid initialized to the stored dimensions.
+     * @param OutColumns - Columns that were loaded.
+     * @return False if no column could be read or the columns disagree on dimensions.
+     */
+    static bool LoadColumnar(const FString& Directory, FClimateGrid& OutGrid, EBiomeDataColumn& OutColumns);
+
+    /** Parses a comma-separated list of column names, e.g. "Latitude,Longitude,Biome", or "All" / "Default". */
+    static bool ParseColumns(const FString& Names, EBiomeDataColumn& OutColumns);
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BiomeInputShared.h"
+#include "BiomeGenerationCommandlet.generated.h"
+
+/**
+ * Headless entry point for batch biome generation, e.g. on render-farm nodes:
+ *   UnrealEditor-Cmd <Project>.uproject -run=BiomeGeneration -nullrhi -Heightmap=<path> [options]
+ *   UnrealEditor-Cmd <Project>.uproject -run=BiomeGeneration -nullrhi -Batch=<dir or manifest> [options]
+ *
+ * Options (defaults match the editor sliders):
+ *   -Output=<dir>          Output directory, default Saved/BiomeMapper[/<heightmap name>]
+ *   -NorthLat= -SouthLat= -CentralLon= -MinAlt= -MaxAlt= -SeaLevel=   FInputParameters
+ *   -YearLength= -DayLength= -DayOfYear=                              FPlanetTime settings
+ *   -Jobs= -MemoryBudgetMB=                                           Batch concurrency and memory cap
+ *   -Tiled [-TileSize=] [-HaloSize=]                                  Single heightmap through the out-of-core tiled pipeline
+ *   -CSV | -Columnar       Also export per-cell data as BiomeDataLog.csv or BiomeData/<Column>.bmc (in-core runs only)
+ *   -Columns=<a,b,...>     Exported columns, e.g. Latitude,Longitude,Biome, or All; default as the original CSV
+ *   -LookupTable           Classify with the compiled lookup table, see FBiomeLookupTable
+ *   -ValidateLookupTable   With -LookupTable, also run the exact path and log the cells where the table differs
+ *   -ExactMath             Evaluate the climate functions with FMath instead of ClimateMath's approximations
+ *   -NoISPC                Run the C++ kernels even where this build has ISPC ones, see BiomeISPC
+ *
+ * Batches are run by FBiomeBatchScheduler, see CollectJobs for the manifest format. Each heightmap
+ * gets the biome and climate-field planes with their .hdr files, BiomePalette.csv,
+ * BiomeLatitudeBands.csv and BiomeSummary.txt. Returns 0 if every heightmap succeeded and 1 otherwise.
+ */
+UCLASS()
+class BIOMEMAPPER_API UBiomeGenerationCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UBiomeGenerationCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    /** Reads the input parameters from the command line, starting from the editor defaults. */
+    static FInputParameters ParseInputParameters(const FString& Params);
+};
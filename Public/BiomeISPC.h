@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef INTEL_ISPC
+    #define INTEL_ISPC 0
+#endif
+
+/**
+ * Switch between the ISPC kernels and their C++ fallbacks.
+ *
+ * UnrealBuildTool compiles the module's .ispc files for every instruction set the target
+ * platform supports (SSE4, AVX2 and AVX-512 on x64) and sets INTEL_ISPC; the widest variant is
+ * picked at runtime. Elsewhere only the C++ paths exist. Slope and aspect, the default climate
+ * stages and biome scoring have ISPC kernels. Both paths agree up to float rounding and the
+ * ISPC standard library's transcendentals; runs in EClimateMathMode::Exact always use C++,
+ * so their results do not depend on the build.
+ */
+class BIOMEMAPPER_API BiomeISPC
+{
+public:
+    /** True if this build contains the ISPC kernels. */
+    static constexpr bool IsAvailable() { return INTEL_ISPC != 0; }
+
+    /** True if the ISPC kernels should run: they are available and have not been disabled. */
+    static bool IsEnabled();
+
+    /** Enables or disables the ISPC kernels for the whole process, e.g. to compare against the C++ paths. On by default. */
+    static void SetEnabled(bool bEnabled);
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Progress and cancellation state shared between a background biome job and the UI.
+ * The job reports stages and work units from any thread; the UI polls the fractions
+ * and may request cancellation, which the job honours at its next chunk boundary.
+ */
+class BIOMEMAPPER_API FBiomeJobProgress
+{
+public:
+    /** @param InNumStages - Number of stages the job will report, for the overall fraction. */
+    explicit FBiomeJobProgress(int32 InNumStages);
+
+    /**
+     * Starts the next stage.
+     * @param Name - Stage name shown to the user.
+     * @param TotalWork - Work units the stage will report through AddWork.
+     */
+    void BeginStage(const FString& Name, int64 TotalWork = 1);
+
+    /** Reports finished work units of the current stage. Safe to call from worker threads. */
+    void AddWork(int64 Amount = 1) { StageWork.fetch_add(Amount, std::memory_order_relaxed); }
+
+    /** Requests cancellation. */
+    void Cancel() { bCancelled.store(true, std::memory_order_relaxed); }
+
+    /** Whether cancellation was requested; checked by the job at chunk boundaries. */
+    bool IsCancelled() const { return bCancelled.load(std::memory_order_relaxed); }
+
+    /** Completed share of the current stage, from 0 to 1. */
+    float GetStageFraction() const;
+
+    /** Completed share of the whole job, from 0 to 1. */
+    float GetOverallFraction() const;
+
+    /** Name of the current stage, with its position, e.g. "Preprocessing climate (3/4)". */
+    FString GetStageText() const;
+
+private:
+    const int32 NumStages;
+
+    std::atomic<int32> StageIndex;
+    std::atomic<int64> StageWork;
+    std::atomic<int64> StageTotal;
+    std::atomic<bool> bCancelled;
+
+    mutable FCriticalSection StageNameLock;
+    FString StageName;
+};
+
+/** Whether an optional job progress requested cancellation. */
+inline bool IsJobCancelled(const FBiomeJobProgress* Progress)
+{
+    return Progress != nullptr && Progress->IsCancelled();
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BiomeRegistry.h"
+#include "BiomeInputShared.h"
+
+/**
+ * Settings for the compiled biome classification table.
+ */
+struct BIOMEMAPPER_API FBiomeLookupTableSettings
+{
+    /** Classify cells with a table fetch instead of evaluating the rules and weights per cell. */
+    bool bEnabled = false;
+
+    /** Also run the exact path for every cell and report the cells where the table differs. */
+    bool bValidate = false;
+
+    /** Bin width of each axis. Rule thresholds are always added as extra bin edges. */
+    float TemperatureStep = 5.0f;
+    float PrecipitationStep = 250.0f;
+    float LatitudeStep = 10.0f;
+    float AltitudeStep = 500.0f;
+    float SlopeStep = 15.0f;
+    float AspectStep = 90.0f;
+
+    /** Range covered by the temperature and precipitation axes; values outside are clamped. */
+    FVector2f TemperatureRange = FVector2f(-60.0f, 60.0f);
+    FVector2f PrecipitationRange = FVector2f(0.0f, 5000.0f);
+
+    /** Tables with more entries than this are not built and the exact path is used. */
+    int64 MaxEntries = 64ll * 1024 * 1024;
+};
+
+/**
+ * Quantized six-dimensional table of the biome decision, compiled from the classification
+ * rules and the registry weights.
+ *
+ * The candidate rules only compare against fixed thresholds, so every threshold is a bin
+ * edge (twice, to separate inclusive from exclusive comparisons) and the candidate set is
+ * exact in every bin. Only the weighted score is evaluated at the bin center, so cells near
+ * a score tie between two candidates may resolve differently from the exact path.
+ */
+class BIOMEMAPPER_API FBiomeLookupTable
+{
+public:
+
+    /**
+     * Compiles the table. Latitude and altitude axes span the classified input ranges.
+     * @return false if the table would exceed Settings.MaxEntries.
+     */
+    bool Build(const FBiomeLookupTableSettings& Settings, const FInputParameters& InputParams);
+
+    /** Releases the table. */
+    void Empty();
+
+    bool IsBuilt() const { return Entries.Num() > 0; }
+
+    /** Looks up the biome for a set of climate values. */
+    EBiomeId Classify(float Temperature, float AnnualPrecipitation, float Latitude, float Altitude, float Slope, float Aspect) const;
+
+    /** Memory held by the table, in bytes. */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+
+    /** One table dimension: sorted lower bin edges and the value each bin is scored at. */
+    struct FAxis
+    {
+        TArray<float> Edges;
+        TArray<float> Centers;
+
+        void Build(float Min, float Max, float Step, const TArray<float>& Thresholds);
+        int32 FindBin(float Value) const;
+        int32 Num() const { return Edges.Num(); }
+    };
+
+    FAxis TemperatureAxis;
+    FAxis PrecipitationAxis;
+    FAxis LatitudeAxis;
+    FAxis AltitudeAxis;
+    FAxis SlopeAxis;
+    FAxis AspectAxis;
+
+    /** Biome per bin, slope and aspect varying fastest. */
+    TArray<EBiomeId> Entries;
+};
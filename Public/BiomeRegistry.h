@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Compact biome identifier, stored per cell in place of the biome name.
+ * Classified biomes are declared in the order the classification rules consider them,
+ * which is also the tie-break order when two candidates score the same.
+ */
+enum class EBiomeId : uint8
+{
+    Ocean,
+    Unknown,
+    TropicalRainforest,
+    TropicalMonsoonForests,
+    Savanna,
+    TemperateSteppeAndSavanna,
+    TemperateBroadleaf,
+    SubtropicalEvergreenForest,
+    Mediterranean,
+    XericShrubland,
+    DryForestAndWoodlandSavanna,
+    HotAridDesert,
+    Tundra,
+    MontaneForestsAndGrasslands,
+    TaigaBorealForest,
+    ColdOrPolarDesert,
+
+    Count
+};
+
+/** Set of candidate biomes, one bit per EBiomeId. */
+using FBiomeCandidateMask = uint32;
+
+/** Bit for a biome in a candidate mask. */
+constexpr FBiomeCandidateMask BiomeMaskBit(EBiomeId Id)
+{
+    return FBiomeCandidateMask(1) << static_cast<uint32>(Id);
+}
+
+/**
+ * Structure defining the weightings for biomes.
+ */
+struct FBiomeWeights
+{
+    float TempWeight;       // Weight for temperature influence
+    float PrecWeight;       // Weight for precipitation influence
+    float LatitudeWeight;   // Weight for latitude influence
+    float AltitudeWeight;   // Weight for altitude influence
+    float SlopeWeight;      // Weight for slope influence
+    float AspectWeight;     // Weight for aspect influence
+};
+
+/**
+ * Display name, palette color and scoring weights of a biome.
+ */
+struct FBiomeDefinition
+{
+    FString Name;
+    FColor Color;
+    FBiomeWeights Weights;
+};
+
+/**
+ * Registry of every biome the calculator can produce, indexed by EBiomeId.
+ * Names are only resolved here, at display and export time.
+ */
+class BIOMEMAPPER_API FBiomeRegistry
+{
+public:
+    /** Number of registered biomes, including Ocean and Unknown. */
+    static constexpr int32 Num() { return static_cast<int32>(EBiomeId::Count); }
+
+    static const FBiomeDefinition& Get(EBiomeId Id);
+    static const FString& GetName(EBiomeId Id) { return Get(Id).Name; }
+    static FColor GetColor(EBiomeId Id) { return Get(Id).Color; }
+    static const FBiomeWeights& GetWeights(EBiomeId Id) { return Get(Id).Weights; }
+
+    /**
+     * Looks up a biome by display name.
+     * @return The biome, or EBiomeId::Unknown if no biome has that name.
+     */
+    static EBiomeId FindByName(const FString& Name);
+
+    /** Palette of biome colors indexed by EBiomeId. */
+    static const TArray<FColor>& GetPalette();
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BiomeInputShared.h"
+#include "PlanetTime.h"
+#include "ClimateMath.h"
+
+/**
+ * Everything a biome run depends on besides the heightmap: the planet and its time, and the
+ * user input parameters. Each run owns its context and passes it explicitly to every stage,
+ * so concurrent runs, parameter sweeps and re-runs with new settings do not interfere.
+ */
+struct BIOMEMAPPER_API FBiomeSimulationContext
+{
+    /** Year and day length, and the simulated day. */
+    FPlanetTime PlanetTime;
+
+    /** Latitude, longitude, altitude and sea level inputs. */
+    FInputParameters InputParams;
+
+    /** How the climate passes evaluate transcendental functions; Exact reproduces the FMath results. */
+    EClimateMathMode MathMode = EClimateMathMode::Fast;
+};
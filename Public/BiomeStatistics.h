@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BiomeRegistry.h"
+
+/**
+ * Occurrence counts and area coverage of the classified biomes, overall and per latitude band.
+ * Cells cover equal steps of latitude and longitude, so each cell's area is weighted by
+ * cos(latitude). Workers accumulate into their own instance and the results are merged.
+ */
+struct BIOMEMAPPER_API FBiomeStatistics
+{
+public:
+    /** Width of a latitude band in degrees. */
+    static constexpr int32 LatitudeBandDegrees = 10;
+
+    /** Number of latitude bands from the south pole to the north pole. */
+    static constexpr int32 NumLatitudeBands = 180 / LatitudeBandDegrees;
+
+    FBiomeStatistics() { Reset(); }
+
+    /** Clears every count. */
+    void Reset();
+
+    /**
+     * Records one classified cell.
+     * @param Biome - Biome of the cell.
+     * @param LatitudeBand - Band of the cell, see GetLatitudeBand.
+     * @param AreaWeight - Relative area of the cell, see GetAreaWeight.
+     */
+    void Add(EBiomeId Biome, int32 LatitudeBand, double AreaWeight)
+    {
+        const int32 BiomeIndex = static_cast<int32>(Biome);
+        Counts[BiomeIndex]++;
+        Area[BiomeIndex] += AreaWeight;
+        BandCounts[LatitudeBand][BiomeIndex]++;
+        BandArea[LatitudeBand][BiomeIndex] += AreaWeight;
+    }
+
+    /** Adds the counts of another instance to this one. */
+    void Merge(const FBiomeStatistics& Other);
+
+    /** Total number of classified cells. */
+    int64 GetTotalCount() const;
+
+    /** Total area weight of the classified cells. */
+    double GetTotalArea() const;
+
+    /** Share of the classified area covered by a biome, from 0 to 1. */
+    double GetCoverage(EBiomeId Biome) const;
+
+    /** Band index of a latitude, clamped to the valid range. */
+    static int32 GetLatitudeBand(float Latitude);
+
+    /** Southern edge of a band, in degrees. */
+    static int32 GetLatitudeBandMin(int32 LatitudeBand) { return -90 + LatitudeBand * LatitudeBandDegrees; }
+
+    /** Relative area of a cell at a latitude. */
+    static double GetAreaWeight(float Latitude);
+
+    /** Formats the per-band breakdown as CSV: one row per band and detected biome. */
+    FString FormatLatitudeBandsCSV() const;
+
+    /** Occurrence count indexed by EBiomeId. */
+    int64 Counts[FBiomeRegistry::Num()];
+
+    /** Area weight indexed by EBiomeId. */
+    double Area[FBiomeRegistry::Num()];
+
+    /** Occurrence count per latitude band, indexed by EBiomeId. */
+    int64 BandCounts[NumLatitudeBands][FBiomeRegistry::Num()];
+
+    /** Area weight per latitude band, indexed by EBiomeId. */
+    double BandArea[NumLatitudeBands][FBiomeRegistry::Num()];
+};
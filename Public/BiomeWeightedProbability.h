@@ -1,22 +1,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BiomeRegistry.h"
+#include "ClimateMath.h"
 
-/**
- * Structure defining the weightings for biomes.
- */
-struct FBiomeWeights
-{
-    float TempWeight;       // Weight for temperature influence
-    float PrecWeight;       // Weight for precipitation influence    
-    float LatitudeWeight;   // Weight for latitude influence
-    float AltitudeWeight;   // Weight for altitude influence
-    float SlopeWeight;      // Weight for slope influence
-    float AspectWeight;     // Weight for aspect influence
-};
-
-/** Global weight map associating biomes with their respective weights. */
-extern TMap<FString, FBiomeWeights> BiomeWeightMap;
+/** Number of cells CalculateBiomeProbabilitiesBatch scores per call at most. */
+constexpr int32 BIOME_SCORE_BATCH_SIZE = 256;
 
 /**
  * Calculate biome probabilities based on environmental parameters.
@@ -26,14 +15,39 @@ extern TMap<FString, FBiomeWeights> BiomeWeightMap;
  * @param Altitude - Altitude value.
  * @param Slope - Slope value.
  * @param Aspect - Aspect value.
- * @param Candidates - List of candidate biomes.
- * @return The most probable biome as a string.
+ * @param Candidates - Mask of candidate biomes.
+ * @return The most probable biome, or EBiomeId::Unknown if no candidate scores above zero.
  */
-FString CalculateBiomeProbabilities(
+EBiomeId CalculateBiomeProbabilities(
     float AdjustedTemperature,
     float Precipitation,
     float Latitude,
     float Altitude,
     float Slope,
     float Aspect,
-    TArray<FString> Candidates);
+    FBiomeCandidateMask Candidates);
+
+/**
+ * Climate values of a batch of cells, one array per input, for CalculateBiomeProbabilitiesBatch.
+ */
+struct FBiomeScoreBatch
+{
+    float Temperature[BIOME_SCORE_BATCH_SIZE];
+    float Precipitation[BIOME_SCORE_BATCH_SIZE];
+    float Latitude[BIOME_SCORE_BATCH_SIZE];
+    float Altitude[BIOME_SCORE_BATCH_SIZE];
+    float Slope[BIOME_SCORE_BATCH_SIZE];
+    float Aspect[BIOME_SCORE_BATCH_SIZE];
+    FBiomeCandidateMask Candidates[BIOME_SCORE_BATCH_SIZE];
+};
+
+/**
+ * Scores a batch of cells against every biome at once and picks the most probable candidate per cell.
+ * Gives the same result as calling CalculateBiomeProbabilities for each cell, without allocating.
+ * Runs the ISPC kernel when BiomeISPC is enabled, except in exact math mode.
+ * @param Batch - Climate values and candidate masks of the cells.
+ * @param Num - Number of cells in the batch, at most BIOME_SCORE_BATCH_SIZE.
+ * @param OutBiomes - Receives the biome of each cell.
+ * @param MathMode - The run's math mode; exact runs always score on the C++ path, so ties break the same in every build.
+ */
+void CalculateBiomeProbabilitiesBatch(const FBiomeScoreBatch& Batch, int32 Num, EBiomeId* OutBiomes, EClimateMathMode MathMode = EClimateMathMode::Fast);
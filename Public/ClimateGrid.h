@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HeightmapCell.h"
+#include "BiomeRegistry.h"
+#include "OceanProximityCache.h"
+#include "OceanCurrents.h"
+
+/**
+ * Structure-of-arrays storage for a heightmap and every climate field derived from it.
+ * Each field lives in its own contiguous plane indexed by Y * Width + X, so a pass only
+ * pulls the planes it actually touches through the cache. Latitude depends only on the
+ * row and longitude only on the column, so they are stored once per row and per column.
+ *
+ * FHeightmapCell remains the per-cell view used by Blueprint and hover queries (see GetCell).
+ */
+struct BIOMEMAPPER_API FClimateGrid
+{
+public:
+
+    /** Allocates every plane for the given dimensions, filled with the FHeightmapCell defaults. */
+    void Init(int32 InWidth, int32 InHeight);
+
+    /**
+     * Releases every plane. The nearest-ocean cache is kept, so reloading the same
+     * heightmap at the same sea level reuses it; empty OceanProximity to release it too.
+     */
+    void Empty();
+
+    /** Number of cells in the grid. */
+    int32 Num() const { return Width * Height; }
+
+    bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Num(); }
+
+    float GetLatitude(int32 Index) const { return RowLatitude[Index / Width]; }
+    float GetLongitude(int32 Index) const { return ColumnLongitude[Index % Width]; }
+
+    /** Gathers every field of a cell into an FHeightmapCell view. */
+    FHeightmapCell GetCell(int32 Index) const;
+
+    /** Memory held by the planes, in bytes. */
+    SIZE_T GetAllocatedSize() const;
+
+    /** Bytes of the per-cell planes for one cell, for sizing grids against a memory budget. */
+    static SIZE_T GetBytesPerCell();
+
+    int32 Width = 0;
+    int32 Height = 0;
+
+    /** Geographic latitude of each row. */
+    TArray<float> RowLatitude;
+
+    /** Geographic longitude of each column. */
+    TArray<float> ColumnLongitude;
+
+    /** Pixels per degree of latitude (X) and longitude (Y); zero if the grid has no geographic extent. */
+    FVector2D Resolution = FVector2D::ZeroVector;
+
+    /** Cell type, Land, Ocean, River or Lake */
+    TArray<ECellType> CellType;
+
+    /** Altitude or depth of the cell. */
+    TArray<float> Altitude;
+
+    /** Depth of the ocean if the cell is underwater. */
+    TArray<float> OceanDepth;
+
+    /** Distance to the nearest ocean pixel. */
+    TArray<float> DistanceToOcean;
+
+    /** Normalized vector from the nearest ocean cell to this cell. */
+    TArray<FVector2f> OceanToLandVector;
+
+    /** Wind direction. */
+    TArray<FVector2f> WindDirection;
+
+    /** Is the wind onshore (true) or offshore (false). */
+    TArray<bool> IsWindOnshore;
+
+    /** Degrees of incline. */
+    TArray<float> Slope;
+
+    /** Direction the slope faces (0-360°). */
+    TArray<float> Aspect;
+
+    /** Zevenbergen-Thorne curvature in 1/m; positive on ridges, negative in valleys. */
+    TArray<float> Curvature;
+
+    /** Elevation range of the cell and its eight neighbors, in meters. */
+    TArray<float> Roughness;
+
+    /** Temperature in Celsius. */
+    TArray<float> Temperature;
+
+    /** Annualized precipitation in millimeters. */
+    TArray<float> AnnualPrecipitation;
+
+    /** Reflectivity (0.0 - 1.0). */
+    TArray<float> Albedo;
+
+    /** Temperature of the ocean current affecting the cell. */
+    TArray<float> ClosestOceanTemperature;
+
+    /** Ocean current affecting the cell. Warm or Cold. */
+    TArray<EOceanCurrentType> ClosestOceanCurrentType;
+
+    /** The ocean current flow direction for the nearest ocean pixel. */
+    TArray<EOceanFlowDirection> FlowDirection;
+
+    /** Biome of the cell; names and colors are resolved through FBiomeRegistry. */
+    TArray<EBiomeId> BiomeId;
+
+    /** Nearest ocean cells memoized for the current ocean mask, see CalculateDistanceToOcean. */
+    FOceanProximityCache OceanProximity;
+};
+
+/**
+ * A finished grid shared between the editor, its viewers and exporters without copying.
+ * Nothing writes to a grid once it has been published this way.
+ */
+using FClimateGridSnapshot = TSharedPtr<const FClimateGrid, ESPMode::ThreadSafe>;
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimateGrid.h"
+#include "BiomeSimulationContext.h"
+
+class FBiomeJobProgress;
+
+/**
+ * Climate terms that depend only on a row's latitude, and for some terms on the hemisphere of the
+ * longitude, computed once per row instead of once per cell. Terms that vary by hemisphere are
+ * indexed by FClimateCell::Hemisphere: 0 west of the central meridian, 1 east of it.
+ */
+struct FClimateRow
+{
+    /** Combined global, pressure and seasonal wind. */
+    FVector2D WindDirection[2];
+
+    /** See Temperature::CalculateSolarInsolation. */
+    float SolarInsolation = 0.0f;
+
+    /** See Precipitation::CalculateLatitudeFactor. */
+    float PrecipitationLatitudeFactor = 0.0f;
+
+    /** See Albedo::CalculateAlbedo. */
+    float BaseAlbedo = 0.0f;
+
+    /** See OceanTemperature::CalculateWaterEffect. */
+    float OceanWaterEffect[2] = { 0.0f, 0.0f };
+};
+
+/**
+ * One cell as the climate stages see it: its inputs, and the fields the stages build up.
+ * Loaded from the grid once, passed through every stage, and stored once.
+ */
+struct FClimateCell
+{
+    // Inputs
+    float Latitude = 0.0f;
+    float Longitude = 0.0f;
+    float Altitude = 0.0f;
+    float DistanceToOcean = 0.0f;
+    float Slope = 0.0f;
+    float Aspect = 0.0f;
+    FVector2D OceanToLandVector = FVector2D::ZeroVector;
+    EOceanFlowDirection FlowDirection = EOceanFlowDirection::Clockwise;
+    bool bIsOcean = false;
+
+    // Precomputed terms of the cell's row, and which hemisphere's terms apply
+    const FClimateRow* Row = nullptr;
+    int32 Hemisphere = 0;
+
+    // See Precipitation::CalculateOceanFactor; evaluated for the whole row with ClimateMath
+    float PrecipitationOceanFactor = 0.0f;
+
+    // Outputs, starting from the grid's current values
+    FVector2D WindDirection = FVector2D::ZeroVector;
+    bool bIsWindOnshore = false;
+    float Temperature = 0.0f;
+    float Precipitation = 0.0f;
+    float Albedo = 0.0f;
+};
+
+/**
+ * Stages of the climate kernel, in the order they run on each cell.
+ */
+enum class EClimateStage : uint8
+{
+    /** Prevailing wind and whether it blows onshore. All cells. */
+    Wind,
+
+    /** Surface temperature from latitude, altitude, terrain and season. Land only. */
+    SurfaceTemperature,
+
+    /** Ocean influence on the temperature. Land only. */
+    OceanModeration,
+
+    /** Annual precipitation. Land only. */
+    Precipitation,
+
+    /** Onshore wind and coastal adjustments of temperature and precipitation. Land only. */
+    WeatherAdjustment,
+
+    /** Albedo from latitude, snow and vegetation. All cells, clamped. */
+    Albedo,
+
+    /** Cooling by the albedo. All cells; ocean cells cool from a fixed base, so repeated runs agree. */
+    AlbedoTemperature,
+
+    Num
+};
+
+/** Computes one stage for one cell. */
+using FClimateStageFunction = void (*)(FClimateCell& Cell, const FBiomeSimulationContext& Context);
+
+/**
+ * Fused per-cell climate pass. The grid is processed in row blocks sized to stay in cache,
+ * blocks in parallel, and each cell runs through every enabled stage while it is in registers,
+ * instead of one full-grid sweep per stage. Stages can be replaced or disabled individually.
+ * The default kernel also has an ISPC implementation, see BiomeISPC.
+ */
+class BIOMEMAPPER_API FClimateKernel
+{
+public:
+    /** A kernel with every stage enabled and set to its default implementation. */
+    FClimateKernel();
+
+    /** The default kernel, used when PreprocessData is not given one. */
+    static const FClimateKernel& GetDefault();
+
+    /** The default implementation of a stage. */
+    static FClimateStageFunction GetDefaultStage(EClimateStage Stage);
+
+    /** Replaces the implementation of a stage; null disables it. */
+    void SetStage(EClimateStage Stage, FClimateStageFunction Function);
+
+    void SetStageEnabled(EClimateStage Stage, bool bEnabled);
+    bool IsStageEnabled(EClimateStage Stage) const;
+
+    /** True if every stage is enabled and has its default implementation; only such kernels run on the ISPC path. */
+    bool IsDefault() const;
+
+    /**
+     * Precomputes the latitude terms of every row. Run calls this once per run.
+     * @param Grid - The climate grid, with its RowLatitude.
+     * @param OutRows - One entry per grid row.
+     */
+    static void BuildRowTable(const FClimateGrid& Grid, TArray<FClimateRow>& OutRows);
+
+    /**
+     * Runs the enabled stages over every cell of the grid.
+     * Per-cell exponentials are batched per row with ClimateMath, in the context's math mode.
+     * @param Grid - The climate grid; slope, aspect and the ocean fields must already be computed.
+     * @param Context - The run's planet, time and input parameters.
+     * @param Progress - Optional progress; the current stage receives one work unit per row, and blocks are skipped once cancelled.
+     * @return False if cancelled.
+     */
+    bool Run(FClimateGrid& Grid, const FBiomeSimulationContext& Context, FBiomeJobProgress* Progress = nullptr) const;
+
+private:
+    FClimateStageFunction Stages[static_cast<int32>(EClimateStage::Num)];
+    bool bStageEnabled[static_cast<int32>(EClimateStage::Num)];
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * How ClimateMath evaluates its functions.
+ */
+enum class EClimateMathMode : uint8
+{
+    /** Branch-free polynomial approximations, within the error bounds documented on each function. */
+    Fast,
+
+    /** FMath, one element at a time; the reference the fast mode is measured against. */
+    Exact
+};
+
+/**
+ * Transcendental functions over arrays, for the per-cell climate passes.
+ *
+ * The fast mode evaluates the same branch-free approximation on every element, in blocks of
+ * LaneCount, so compilers turn the loops into 4- or 8-wide SIMD code instead of one libm call per
+ * cell. Each function documents its worst-case error against the exact result over the stated
+ * domain. The exact mode calls the matching FMath function per element, so a run can be repeated
+ * exactly to check that the climate fields stay within tolerance.
+ *
+ * Input and output arrays may be the same array, but must not otherwise overlap.
+ */
+class BIOMEMAPPER_API ClimateMath
+{
+public:
+    /** Elements processed per block. */
+    static constexpr int32 LaneCount = 8;
+
+    /**
+     * e^X.
+     * Fast: relative error below 1.2e-7 for X in [-87.3, 88.3]. Inputs outside that range are
+     * clamped to it, so very negative inputs give about 1.2e-38 rather than 0.
+     */
+    static void Exp(const float* X, float* Out, int32 Num, EClimateMathMode Mode = EClimateMathMode::Fast);
+
+    /**
+     * Arc tangent of X, in radians.
+     * Fast: absolute error below 2e-7 for all finite X.
+     */
+    static void Atan(const float* X, float* Out, int32 Num, EClimateMathMode Mode = EClimateMathMode::Fast);
+
+    /**
+     * Angle of the vector (X, Y), in radians in [-PI, PI], with the same quadrant and zero
+     * handling as FMath::Atan2; (0, 0) gives 0.
+     * Fast: absolute error below 3e-7 for all finite inputs.
+     */
+    static void Atan2(const float* Y, const float* X, float* Out, int32 Num, EClimateMathMode Mode = EClimateMathMode::Fast);
+
+    /**
+     * Cosine of X, in radians.
+     * Fast: absolute error below 1e-7 for |X| <= 8192; larger inputs lose accuracy.
+     */
+    static void Cos(const float* X, float* Out, int32 Num, EClimateMathMode Mode = EClimateMathMode::Fast);
+
+    /**
+     * Base^Exponent for non-negative bases; bases of 0 or below give 0.
+     * Fast: relative error below 1.5e-7 * (1 + |Exponent * ln(Base)|) while the result is a
+     * normal float.
+     */
+    static void Pow(const float* Base, float Exponent, float* Out, int32 Num, EClimateMathMode Mode = EClimateMathMode::Fast);
+
+    /** Name of a mode, for logging. */
+    static const TCHAR* GetModeName(EClimateMathMode Mode);
+};
@@ -1,19 +1,65 @@
 #pragma once
 
-#include "HeightmapCell.h"
+#include "ClimateGrid.h"
 
+/**
+ * Find the nearest ocean cell for every cell with an exact Euclidean distance transform,
+ * then copy the ocean temperature, current type and flow direction of that ocean cell.
+ * @param Grid - The climate grid.
+ * @param OutDistanceMap - Euclidean distance (in cells) to the nearest ocean cell, FLT_MAX if none.
+ * @param OutClosestOceanIndex - Index of the nearest ocean cell, or -1 if none.
+ * @return True if calculation succeeded, false otherwise.
+ */
 bool FindClosestOceanCell(
-    const TArray<FHeightmapCell>& Data,
-    int32 Width,
-    int32 Height,
+    FClimateGrid& Grid,
     TArray<float>& OutDistanceMap,
     TArray<int32>& OutClosestOceanIndex);
 
 /**
- * Calculate the distance of each cell to the nearest ocean.
- * @param Data - Array of heightmap cells.
+ * Fill the distance to ocean, ocean-to-land vectors and nearest-ocean attributes of every cell.
+ * The nearest ocean cells are memoized in Grid.OceanProximity and the distance transform is only
+ * rerun when the ocean mask changes, so any stage can call this to request the fields.
+ * @param Grid - The climate grid.
+ * @return True if calculation succeeded, false otherwise.
+ */
+bool CalculateDistanceToOcean(FClimateGrid& Grid);
+
+/**
+ * Out-of-core FindClosestOceanCell over a whole heightmap, for grids that are processed in
+ * tiles. The ocean mask is read once, top to bottom, in strips of rows; the column pass is
+ * spilled to a scratch file, 4 bytes per cell, and the row pass writes the nearest ocean cell
+ * of every cell to OutFilePath as row-major FIntPoint(X, Y), (INDEX_NONE, INDEX_NONE) if there
+ * is no ocean. Results match FindClosestOceanCell on the whole heightmap.
  * @param Width - Width of the heightmap.
  * @param Height - Height of the heightmap.
- * @return True if calculation succeeded, false otherwise.
+ * @param MaxStripCells - Cells per strip held in memory, at 17 bytes each.
+ * @param ReadOceanMask - Called as ReadOceanMask(FirstRow, NumRows, OutMask) to fill the mask
+ *                        of consecutive rows, non-zero where OceanDepth would be positive.
+ * @param ScratchFilePath - File for the column pass; deleted before returning.
+ * @param OutFilePath - File receiving the nearest ocean cells.
+ * @return True if both passes were written.
+ */
+bool FindClosestOceanCellsToFile(
+    int32 Width,
+    int32 Height,
+    int64 MaxStripCells,
+    TFunctionRef<void(int32, int32, uint8*)> ReadOceanMask,
+    const FString& ScratchFilePath,
+    const FString& OutFilePath);
+
+/**
+ * Fills the distance to ocean, ocean-to-land vectors and nearest-ocean attributes of a grid
+ * covering a region of a larger heightmap, from nearest ocean cells found over the whole
+ * heightmap by FindClosestOceanCellsToFile. Replaces CalculateDistanceToOcean for such grids.
+ * @param Grid - Grid built for Region by UHeightmapParser::BuildClimateGrid.
+ * @param Region - Region of the full heightmap covered by the grid.
+ * @param ClosestOceanCells - Nearest ocean cell of each grid cell, in full heightmap coordinates.
+ * @param FullRowLatitude - Latitude of every row of the full heightmap.
+ * @param FullColumnLongitude - Longitude of every column of the full heightmap.
  */
-bool CalculateDistanceToOcean(TArray<FHeightmapCell>& Data, int32 Width, int32 Height);
\ No newline at end of file
+void ApplyClosestOceanCells(
+    FClimateGrid& Grid,
+    const FIntRect& Region,
+    const FIntPoint* ClosestOceanCells,
+    const TArray<float>& FullRowLatitude,
+    const TArray<float>& FullColumnLongitude);
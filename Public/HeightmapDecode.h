@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Layout of the samples in a heightmap source.
+ */
+enum class EHeightmapSampleFormat : uint8
+{
+    UInt8,              // Normalized by 255
+    UInt16,             // Little-endian, normalized by 65535
+    UInt16BigEndian,    // Big-endian, normalized by 65535
+    UInt32,             // Little-endian, normalized by 4294967295
+    Float32,            // Little-endian IEEE float, stored as is
+    Float32BigEndian    // Big-endian IEEE float, stored as is
+};
+
+/**
+ * Kernels that turn heightmap samples into floats in a single pass, fusing the byte swap,
+ * widening and normalization. Each format has a scalar kernel and, on x86, SSE2 and AVX2
+ * kernels; the widest one the running CPU supports is selected once at runtime.
+ * Every kernel of a format produces bit-identical results.
+ */
+class BIOMEMAPPER_API HeightmapDecode
+{
+public:
+    /** Decodes NumSamples packed samples starting at Source into OutSamples. */
+    using FKernel = void (*)(const uint8* Source, int64 NumSamples, float* OutSamples);
+
+    /**
+     * Picks the fastest kernel for a sample format.
+     * @param Format - Layout of the source samples.
+     * @return The kernel; never null.
+     */
+    static FKernel GetKernel(EHeightmapSampleFormat Format);
+
+    /**
+     * Decodes a buffer of samples with the selected kernel, in parallel chunks.
+     * @param Format - Layout of the source samples.
+     * @param Source - Packed samples.
+     * @param NumSamples - Number of samples to decode.
+     * @param OutSamples - Destination, must hold NumSamples floats.
+     */
+    static void DecodeParallel(EHeightmapSampleFormat Format, const uint8* Source, int64 NumSamples, float* OutSamples);
+
+    /** Size of one sample of a format, in bytes. */
+    static int32 GetBytesPerSample(EHeightmapSampleFormat Format);
+
+    /** Name of the instruction set the kernels were selected for, for logging. */
+    static const TCHAR* GetInstructionSetName();
+};
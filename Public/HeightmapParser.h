@@ -3,9 +3,13 @@
 
 #include "CoreMinimal.h"
 #include "BiomeInputShared.h"
-#include "HeightmapCell.h" // Assume this file defines FHeightmapCell
+#include "ClimateGrid.h"
+#include "BiomeSimulationContext.h"
 #include "HeightmapParser.generated.h"
 
+class FMappedHeightmapFile;
+class FBiomeJobProgress;
+
 /**
  * HeightmapParser handles parsing of various heightmap formats
  * including PNG, JPG, R16, R32, and raw binary heightmaps.
@@ -19,29 +23,54 @@ public:
     /**
      * Parses a heightmap file into structured data.
      * @param FilePath - Path to the heightmap file.
-     * @param InputParams
+     * @param Context - The run's planet, time and input parameters.
      * @param OutMinLongitude - Calculated minimum longitude.
      * @param OutMaxLongitude - Calculated maximum longitude.
-     * @param OutHeightmapData - Parsed heightmap cell data.
+     * @param OutGrid - Parsed heightmap and derived climate fields.
      * @param OutWidth - Output width of the heightmap.
      * @param OutHeight - Output height of the heightmap.
      * @param OutResolution - The resolution of the heightmap.
-     * @return True if parsing is successful.
+     * @param Progress - Optional progress to report stages to; parsing stops early if it is cancelled.
+     * @return True if parsing is successful, false on failure or cancellation.
      */
     static bool ParseHeightmap(
         const FString& FilePath,
-        FInputParameters& InputParams,
+        const FBiomeSimulationContext& Context,
         float& OutMinLongitude,
         float& OutMaxLongitude,
-        TArray<FHeightmapCell>& OutHeightmapData,
+        FClimateGrid& OutGrid,
         int32& OutWidth,
         int32& OutHeight,
-        FVector2D& OutResolution
+        FVector2D& OutResolution,
+        FBiomeJobProgress* Progress = nullptr
     );
 
-
-private:
-    // Helper functions
+    /**
+     * Runs everything ParseHeightmap does after loading: builds the climate grid from decoded
+     * samples, then the ocean distance and climate passes. Lets callers load the next heightmap
+     * while this one is processed.
+     * @param RawData - Normalized samples from LoadHeightmap, row-major.
+     * @param Width - Width of the heightmap.
+     * @param Height - Height of the heightmap.
+     * @param Context - The run's planet, time and input parameters.
+     * @param OutMinLongitude - Calculated minimum longitude.
+     * @param OutMaxLongitude - Calculated maximum longitude.
+     * @param OutGrid - The climate grid.
+     * @param OutResolution - The resolution of the heightmap.
+     * @param Progress - Optional progress to report stages to.
+     * @return True if processing is successful, false on failure or cancellation.
+     */
+    static bool ProcessHeightmapSamples(
+        const TArray<float>& RawData,
+        int32 Width,
+        int32 Height,
+        const FBiomeSimulationContext& Context,
+        float& OutMinLongitude,
+        float& OutMaxLongitude,
+        FClimateGrid& OutGrid,
+        FVector2D& OutResolution,
+        FBiomeJobProgress* Progress = nullptr
+    );
 
     /**
      * Loads heightmap data from a file.
@@ -54,22 +83,11 @@ private:
     int32& BitDepth);
 
     /**
-     * Parses image-based heightmaps (PNG, JPG).
+     * Resolves the dimensions of a heightmap without decoding its samples: raw files are
+     * mapped, images only have their header parsed.
+     * @return True if the dimensions were determined.
      */
-    static bool ParseImageHeightmap(const FString& FilePath,
-    TArray<float>& OutRawData,
-    int32& OutWidth,
-    int32& OutHeight,
-    int32& BitDepth);
-
-    /**
-     * Parses raw binary heightmaps (R16, R32).
-     */
-    static bool ParseRawHeightmap(const FString& FilePath,
-    TArray<float>& OutHeightmapData,
-    int32& Width,
-    int32& Height,
-    int32 BitDepth);    
+    static bool ReadHeightmapDimensions(const FString& FilePath, int32& OutWidth, int32& OutHeight);
 
     /**
      * Calculates longitude range for the heightmap.
@@ -85,19 +103,74 @@ private:
     );
 
     /**
-     * Checks if the raw data is big-endian.
+     * Maps a raw heightmap (R16, R32) and resolves its dimensions without decoding it.
+     * @param FilePath - Path to the raw heightmap file.
+     * @param OutMappedFile - Mapping to decode samples from.
+     * @param OutWidth - Output width of the heightmap.
+     * @param OutHeight - Output height of the heightmap.
+     * @param InOutBitDepth - Bit depth implied by the extension; may be overridden by a .hdr metadata file.
+     * @return True if the file was mapped and its dimensions determined.
+     */
+    static bool OpenRawHeightmap(
+        const FString& FilePath,
+        FMappedHeightmapFile& OutMappedFile,
+        int32& OutWidth,
+        int32& OutHeight,
+        int32& InOutBitDepth
+    );
+
+    /**
+     * Builds the climate grid for a rectangular region of a heightmap.
+     * Latitude and longitude are derived from the region's position in the full map, and the
+     * resolution from the full map, so every region of one heightmap has the same cell spacing.
+     * @param RegionSamples - Normalized samples for the region, row-major.
+     * @param Region - Region of the full heightmap covered by RegionSamples.
+     * @param FullWidth - Width of the full heightmap.
+     * @param FullHeight - Height of the full heightmap.
+     * @param InputParams - User input parameters.
+     * @param MinLongitude - Minimum longitude of the full heightmap.
+     * @param MaxLongitude - Maximum longitude of the full heightmap.
+     * @param OutGrid - Grid covering the region.
      */
-    static bool IsBigEndian(const TArray<uint8>& Data, int32 BitDepth);
+    static void BuildClimateGrid(
+        const float* RegionSamples,
+        const FIntRect& Region,
+        int32 FullWidth,
+        int32 FullHeight,
+        const FInputParameters& InputParams,
+        float MinLongitude,
+        float MaxLongitude,
+        FClimateGrid& OutGrid
+    );
+
+    /** Latitude BuildClimateGrid assigns to a row of the full heightmap. */
+    static float GetRowLatitude(const FInputParameters& InputParams, int32 Row, int32 FullHeight);
+
+    /** Longitude BuildClimateGrid assigns to a column of the full heightmap. */
+    static float GetColumnLongitude(float MinLongitude, float MaxLongitude, int32 Column, int32 FullWidth);
+
+
+private:
+    // Helper functions
 
     /**
-     * Converts 16-bit raw data from big-endian to little-endian.
+     * Parses image-based heightmaps (PNG, JPG).
      */
-    static void ConvertToLittleEndian(TArray<uint8>& Data);
+    static bool ParseImageHeightmap(const FString& FilePath,
+    TArray<float>& OutRawData,
+    int32& OutWidth,
+    int32& OutHeight,
+    int32& BitDepth);
 
     /**
-     * Converts 32-bit raw data from big-endian to little-endian.
+     * Parses raw binary heightmaps (R16, R32).
+     * The file is memory-mapped and decoded in parallel chunks straight into OutHeightmapData.
      */
-    static void ConvertToLittleEndian32(TArray<uint8>& Data);
+    static bool ParseRawHeightmap(const FString& FilePath,
+    TArray<float>& OutHeightmapData,
+    int32& Width,
+    int32& Height,
+    int32 BitDepth);    
 
     static bool DetermineDimensionsFromFile(int64 FileSize, int32 BitDepth, int32& OutWidth, int32& OutHeight);
     static bool ReadMetadataFromFile(const FString& MetadataFilePath, int32& OutWidth, int32& OutHeight, int32& OutBitDepth);
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HeightmapDecode.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Read-only memory mapping of a raw (R16/R32) heightmap file.
+ * Samples are decoded straight from the mapping into the caller's buffer,
+ * so the file contents are never copied into memory as a whole.
+ */
+class BIOMEMAPPER_API FMappedHeightmapFile
+{
+public:
+    FMappedHeightmapFile();
+    ~FMappedHeightmapFile();
+
+    FMappedHeightmapFile(const FMappedHeightmapFile&) = delete;
+    FMappedHeightmapFile& operator=(const FMappedHeightmapFile&) = delete;
+
+    /**
+     * Maps a raw heightmap file for reading.
+     * Falls back to loading the file into memory if the platform file layer cannot map it.
+     * @param FilePath - Path to the raw heightmap file.
+     * @return True if the file is available for decoding.
+     */
+    bool Open(const FString& FilePath);
+
+    /** Releases the mapping (or the fallback buffer). */
+    void Close();
+
+    bool IsOpen() const { return Data != nullptr; }
+
+    /** Size of the mapped file in bytes. */
+    int64 GetFileSize() const { return Size; }
+
+    /** Number of whole samples in the file for the given bit depth. */
+    int64 GetNumSamples(int32 BitDepth) const;
+
+    /**
+     * Checks the first sample to decide whether the data is big-endian.
+     * @param BitDepth - Bits per sample (16 or 32).
+     */
+    bool IsBigEndian(int32 BitDepth) const;
+
+    /** Sample format of a raw heightmap with the given bit depth (16 or 32) and byte order. */
+    static EHeightmapSampleFormat GetSampleFormat(int32 BitDepth, bool bBigEndian);
+
+    /**
+     * Decodes a contiguous range of samples into floats.
+     * 16-bit samples are normalized to [0, 1], 32-bit samples are read as IEEE floats.
+     * @param BitDepth - Bits per sample (16 or 32).
+     * @param bBigEndian - Whether the samples need byte-swapping.
+     * @param FirstSample - Index of the first sample to decode.
+     * @param NumSamples - Number of samples to decode.
+     * @param OutSamples - Destination, must hold NumSamples floats.
+     */
+    void DecodeSamples(int32 BitDepth, bool bBigEndian, int64 FirstSample, int64 NumSamples, float* OutSamples) const;
+
+    /**
+     * Decodes every sample into a float plane, in parallel chunks.
+     * @param BitDepth - Bits per sample (16 or 32).
+     * @param OutSamples - Destination plane, resized to the number of samples.
+     * @return False if the bit depth is unsupported or the sample count does not fit the plane.
+     */
+    bool DecodeToPlane(int32 BitDepth, TArray<float>& OutSamples) const;
+
+private:
+    TUniquePtr<IMappedFileHandle> MappedHandle;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+
+    // Used only when the platform file layer cannot map the file
+    TArray<uint8> FallbackData;
+
+    const uint8* Data;
+    int64 Size;
+};
@@ -2,6 +2,20 @@
 
 #include "CoreMinimal.h"
 
+/** Direction an ocean gyre turns. */
+enum class EOceanFlowDirection : uint8
+{
+    Clockwise,
+    Counterclockwise
+};
+
+/** Temperature character of an ocean current. */
+enum class EOceanCurrentType : uint8
+{
+    Cold,
+    Warm
+};
+
 /**
  * Class for determining ocean currents and their properties.
  */
@@ -26,6 +40,34 @@ public:
      */
     static FString ValidateFlowDirection(float Latitude, float Longitude, FString FlowDirection);
 
-    
+    /**
+     * Determine the gyre direction at a location.
+     * @param Latitude - Geographic latitude.
+     * @param Longitude - Geographic longitude.
+     * @return The flow direction.
+     */
+    static EOceanFlowDirection GetFlowDirection(float Latitude, float Longitude)
+    {
+        // Clockwise in the north-east and south-west quadrants
+        return ((Latitude >= 0.0f) == (Longitude >= 0.0f)) ? EOceanFlowDirection::Clockwise : EOceanFlowDirection::Counterclockwise;
+    }
+
+    /**
+     * Determine the type of ocean current at a location.
+     * @param Latitude - Geographic latitude.
+     * @param FlowDirection - Flow direction at the location, see GetFlowDirection.
+     * @return The current type.
+     */
+    static EOceanCurrentType GetCurrentType(float Latitude, EOceanFlowDirection FlowDirection)
+    {
+        // Equatorward of 40 degrees, gyres turning clockwise in the north and counterclockwise in the south are warm
+        const EOceanFlowDirection WarmDirection = (Latitude >= 0.0f) ? EOceanFlowDirection::Clockwise : EOceanFlowDirection::Counterclockwise;
+        return (FlowDirection == WarmDirection && FMath::Abs(Latitude) < 40.0f) ? EOceanCurrentType::Warm : EOceanCurrentType::Cold;
+    }
+
+    /** Display name of a flow direction. */
+    static const TCHAR* ToString(EOceanFlowDirection FlowDirection);
 
+    /** Display name of a current type. */
+    static const TCHAR* ToString(EOceanCurrentType CurrentType);
 };
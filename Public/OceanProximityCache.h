@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * What the nearest-ocean fields of a grid depend on: its dimensions, its ocean mask and the
+ * geographic extent its ocean-to-land vectors are measured in. The mask is kept as a hash,
+ * so comparing keys never needs a copy of it.
+ */
+struct BIOMEMAPPER_API FOceanProximityKey
+{
+    int32 Width = 0;
+    int32 Height = 0;
+
+    /** Hash of the ocean mask, one bit per cell. */
+    uint64 OceanMaskHash = 0;
+
+    /** Latitude of the first and last row, longitude of the first and last column. */
+    FVector2f LatitudeExtent = FVector2f::ZeroVector;
+    FVector2f LongitudeExtent = FVector2f::ZeroVector;
+
+    bool operator==(const FOceanProximityKey& Other) const
+    {
+        return Width == Other.Width && Height == Other.Height && OceanMaskHash == Other.OceanMaskHash &&
+               LatitudeExtent == Other.LatitudeExtent && LongitudeExtent == Other.LongitudeExtent;
+    }
+};
+
+/**
+ * Memoized nearest ocean cell of every cell of a climate grid. It only depends on the ocean
+ * mask and the grid's geolocation, so it is kept across stages and reloads and the distance
+ * transform is only rerun when the sea level or the heightmap changes the mask. The grid's
+ * DistanceToOcean and OceanToLandVector planes hold the derived fields; after the grid is
+ * re-initialized they are rebuilt from ClosestOceanIndex in one pass. Filled through
+ * CalculateDistanceToOcean.
+ */
+struct BIOMEMAPPER_API FOceanProximityCache
+{
+public:
+
+    /** Releases the cached index; the next request reruns the distance transform. */
+    void Empty();
+
+    /** Whether the cached index was computed for this key. */
+    bool Matches(const FOceanProximityKey& InKey) const;
+
+    /** Memory held by the cache, in bytes. */
+    SIZE_T GetAllocatedSize() const;
+
+    /** Mask and geolocation ClosestOceanIndex was computed for. */
+    FOceanProximityKey Key;
+
+    /** Index of the nearest ocean cell, or -1 if none. */
+    TArray<int32> ClosestOceanIndex;
+
+    /** Whether the grid planes currently hold the fields derived from ClosestOceanIndex; cleared when the grid is re-initialized. */
+    bool bAppliedToGrid = false;
+};
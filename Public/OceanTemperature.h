@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "OceanCurrents.h"
 
 /**
  * Class for calculating the ocean temperature based on environmental parameters.
@@ -17,5 +18,27 @@ public:
      * @param FlowDirection - Ocean flow direction.
      * @return Adjusted ocean temperature.
      */
-    static float CalculateOceanTemp(float Temperature, float DistanceToOcean, float Latitude, float Longitude, FString FlowDirection);
+    static float CalculateOceanTemp(float Temperature, float DistanceToOcean, float Latitude, float Longitude, EOceanFlowDirection FlowDirection);
+
+    /**
+     * Temperature the nearest ocean current brings, before it fades with distance.
+     * Depends only on latitude and the hemisphere of the longitude, so it can be computed twice per grid row.
+     * @param Latitude - Geographic latitude.
+     * @param Longitude - Geographic longitude; only its sign matters.
+     */
+    static float CalculateWaterEffect(float Latitude, float Longitude);
+
+    /**
+     * CalculateOceanTemp with the water effect already computed for the cell's latitude and hemisphere.
+     * @param WaterEffect - See CalculateWaterEffect.
+     */
+    static float ApplyWaterEffect(float Temperature, float DistanceToOcean, float WaterEffect);
+
+    /**
+     * Surface temperature of an ocean cell: a base that falls with latitude, 7.5 degrees warmer
+     * or colder depending on the current. Land cells take it from their nearest ocean cell.
+     * @param Latitude - Geographic latitude of the ocean cell.
+     * @param CurrentType - Current at the ocean cell, see OceanCurrents::GetCurrentType.
+     */
+    static float CalculateSurfaceTemperature(float Latitude, EOceanCurrentType CurrentType);
 };
@@ -3,19 +3,17 @@
 #include "CoreMinimal.h"
 
 /**
- * A Singleton struct to represent planetary time.
+ * A struct to represent planetary time.
  * Provides functionality for advancing time and retrieving time-related information.
+ * Each run carries its own copy in FBiomeSimulationContext.
  */
 
 struct BIOMEMAPPER_API FPlanetTime
 {
 
 public:
-    // Singleton Access
-    static FPlanetTime& GetInstance();
-
-    // Initialize the Singleton
-    static void Initialize(float YearLengthDays, float DayLengthHours, float DayLengthMinutes, int32 DayOfYear, float TimeOfDay);
+    FPlanetTime();
+    FPlanetTime(float YearLengthDays, float DayLengthHours, float DayLengthMinutes, int32 DayOfYear, float TimeOfDay);
 
     // Getters
     float GetYearLength() const;
@@ -33,13 +31,10 @@ public:
     void SetDayOfYear(int32 NewDayOfYear);
     void SetTimeOfDay(float NewTimeOfDay);
 
-private:
-    // Private Constructor for Singleton
-    FPlanetTime();
-    FPlanetTime(float YearLengthDays, float DayLengthHours, float DayLengthMinutes, int32 DayOfYear, float TimeOfDay);
+    bool operator==(const FPlanetTime& Other) const;
+    bool operator!=(const FPlanetTime& Other) const { return !(*this == Other); }
 
-    // Static Instance
-    static FPlanetTime* Instance;
+private:
 
     // Internal Data Members
     float YearLength;          // Length of the year in days
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ClimateMath.h"
 
 /**
  * Class for calculating precipitation based on environmental parameters.
@@ -24,4 +25,51 @@ public:
     float Slope,
     FVector2D WindDirection,
     FVector2D OceanToLandVector);
+
+    /**
+     * Latitude share of the precipitation, wet tropics and dry poles, in mm/year.
+     * Depends only on latitude, so it can be computed once per grid row.
+     * @param Latitude - Geographic latitude (in degrees).
+     */
+    static float CalculateLatitudeFactor(float Latitude);
+
+    /**
+     * CalculatePrecipitation with the latitude factor already computed for the cell's latitude.
+     * @param LatitudeFactor - See CalculateLatitudeFactor.
+     */
+    static float CalculatePrecipitationFromLatitudeFactor(
+    float LatitudeFactor,
+    float Altitude,
+    float DistanceToOcean,
+    float Slope,
+    FVector2D WindDirection,
+    FVector2D OceanToLandVector);
+
+    /**
+     * Ocean proximity share of the precipitation, falling off with distance, in mm/year.
+     * @param DistanceToOcean - Distance to the nearest ocean (in meters).
+     */
+    static float CalculateOceanFactor(float DistanceToOcean);
+
+    /**
+     * CalculateOceanFactor for a run of cells, with the exponential evaluated by ClimateMath.
+     * @param DistanceToOcean - Distances of the cells (in meters).
+     * @param OutFactors - Receives one factor per cell; may be the distance array itself.
+     * @param Num - Number of cells.
+     * @param MathMode - Fast or exact exponential, see ClimateMath::Exp.
+     */
+    static void CalculateOceanFactors(const float* DistanceToOcean, float* OutFactors, int32 Num, EClimateMathMode MathMode = EClimateMathMode::Fast);
+
+    /**
+     * CalculatePrecipitation with the latitude and ocean factors already computed for the cell.
+     * @param LatitudeFactor - See CalculateLatitudeFactor.
+     * @param OceanFactor - See CalculateOceanFactor.
+     */
+    static float CalculatePrecipitationFromFactors(
+    float LatitudeFactor,
+    float OceanFactor,
+    float Altitude,
+    float Slope,
+    FVector2D WindDirection,
+    FVector2D OceanToLandVector);
 };
@@ -1,10 +1,30 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "HeightmapCell.h"
+#include "ClimateGrid.h"
+#include "BiomeSimulationContext.h"
+#include "ClimateKernel.h"
+
+class FBiomeJobProgress;
 
 class Preprocessing
 {
 public:
-    static bool PreprocessData(TArray<FHeightmapCell>& HeightmapData, int32 Width, int32 Height);
+    /**
+     * Computes slope, aspect, wind and climate fields for every cell.
+     * @param Grid - The climate grid.
+     * @param Context - The run's planet, time and input parameters.
+     * @param Progress - Optional progress; reported per row, and the pass stops at the next row block once cancelled.
+     * @param Kernel - Climate stages to run; the default runs all of them.
+     * @return False on failure or cancellation.
+     */
+    static bool PreprocessData(FClimateGrid& Grid, const FBiomeSimulationContext& Context, FBiomeJobProgress* Progress = nullptr,
+                               const FClimateKernel& Kernel = FClimateKernel::GetDefault());
+
+    /**
+     * PreprocessData for a grid whose nearest-ocean fields are already filled, such as a tile
+     * of the out-of-core pipeline (see ApplyClosestOceanCells): slope, aspect and climate only.
+     */
+    static bool PreprocessTerrainAndClimate(FClimateGrid& Grid, const FBiomeSimulationContext& Context, FBiomeJobProgress* Progress = nullptr,
+                                            const FClimateKernel& Kernel = FClimateKernel::GetDefault());
 };
@@ -1,25 +1,22 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "HeightmapCell.h"
+#include "ClimateGrid.h"
+#include "ClimateMath.h"
 #include "Math/Vector2D.h"
 
 /**
- * Utility class for terrain analysis using the D-Infinity method.
+ * Utility class for terrain analysis with 3x3 stencils, see FTerrainStencil.
  */
 class BIOMEMAPPER_API SlopeAndAspect
 {
 public:
     /**
-     * Computes slope and aspect for each heightmap cell.
-     * @param Data - Input heightmap data.
-     * @param Width - Width of the heightmap.
-     * @param Height - Height of the heightmap.
-     * @param OutSlopes - Output array for storing slope values (in degrees).
-     * @param OutAspects - Output array for storing aspect values (in degrees).
+     * Computes the terrain fields of each heightmap cell in one pass over the Altitude plane:
+     * slope and aspect (in degrees) from Horn's gradient, Zevenbergen-Thorne curvature, and
+     * roughness. Distances between cells are in meters, from the grid's Resolution.
+     * @param Grid - The climate grid.
+     * @param MathMode - How the slope and aspect angles are evaluated, see ClimateMath.
      */
-    static void CalculateSlopeAndAspect(
-        TArray<FHeightmapCell>& Data,
-        int32 Width,
-        int32 Height);
+    static void CalculateSlopeAndAspect(FClimateGrid& Grid, EClimateMathMode MathMode = EClimateMathMode::Fast);
 };
@@ -29,4 +29,22 @@ public:
         float Aspect,
         float WindSpeed);
 
+    /**
+     * Share of the equatorial sea-level temperature a latitude receives from the sun, from 0 to 1.
+     * Depends only on latitude, so it can be computed once per grid row.
+     * @param Latitude - Geographic latitude (in degrees).
+     */
+    static float CalculateSolarInsolation(float Latitude);
+
+    /**
+     * CalculateSurfaceTemperature with the solar insolation already computed for the cell's latitude.
+     * @param SolarInsolation - See CalculateSolarInsolation.
+     */
+    static float CalculateSurfaceTemperatureFromInsolation(
+        float SolarInsolation,
+        float Altitude,
+        float Slope,
+        float Aspect,
+        float WindSpeed);
+
 };
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimateGrid.h"
+#include "Async/ParallelFor.h"
+
+/**
+ * Elevations of the 3x3 window around a cell, named as in Horn (1981), with row Y - 1 on top:
+ *   A B C
+ *   D E F
+ *   G H I
+ */
+struct FTerrainWindow
+{
+    float A, B, C;
+    float D, E, F;
+    float G, H, I;
+};
+
+/**
+ * Factors of the stencils for one row, precomputed from the metric spacing of its cells.
+ */
+struct FStencilWeights
+{
+    /** Horn gradient: 1 / (8 dx) and 1 / (8 dy). */
+    float HornX = 0.125f;
+    float HornY = 0.125f;
+
+    /** Zevenbergen-Thorne second derivatives: 1 / dx^2 and 1 / dy^2. */
+    float CurvatureX = 1.0f;
+    float CurvatureY = 1.0f;
+
+    /**
+     * @param SpacingX - Distance between neighboring columns, in meters.
+     * @param SpacingY - Distance between neighboring rows, in meters.
+     */
+    static FStencilWeights FromSpacing(float SpacingX, float SpacingY)
+    {
+        FStencilWeights Weights;
+        Weights.HornX = 1.0f / (8.0f * SpacingX);
+        Weights.HornY = 1.0f / (8.0f * SpacingY);
+        Weights.CurvatureX = 1.0f / (SpacingX * SpacingX);
+        Weights.CurvatureY = 1.0f / (SpacingY * SpacingY);
+        return Weights;
+    }
+};
+
+/**
+ * The rows above, at and below a grid row. At the top and bottom of the grid the edge row
+ * stands in for the missing one.
+ */
+struct FStencilRows
+{
+    const float* Above = nullptr;
+    const float* Center = nullptr;
+    const float* Below = nullptr;
+    int32 Width = 0;
+
+    /** Window of an interior column, 1 <= X < Width - 1, without bounds checks. */
+    FORCEINLINE FTerrainWindow GetWindow(int32 X) const
+    {
+        return {
+            Above[X - 1],  Above[X],  Above[X + 1],
+            Center[X - 1], Center[X], Center[X + 1],
+            Below[X - 1],  Below[X],  Below[X + 1] };
+    }
+
+    /** Window of any column, with the edge column standing in for a missing one. */
+    FTerrainWindow GetBorderWindow(int32 X) const
+    {
+        const int32 Left = FMath::Max(X - 1, 0);
+        const int32 Right = FMath::Min(X + 1, Width - 1);
+        return {
+            Above[Left],  Above[X],  Above[Right],
+            Center[Left], Center[X], Center[Right],
+            Below[Left],  Below[X],  Below[Right] };
+    }
+};
+
+/**
+ * 3x3 stencil engine over a contiguous plane, such as the grid's altitudes.
+ *
+ * Rows are processed in parallel tiles of consecutive rows, so the three input rows of one
+ * row are still in cache for the next. Within a row the interior columns read their window
+ * without any bounds checks; only the first and last column and the first and last row
+ * replicate the edge. Stencil weights come from the metric cell spacing of each row.
+ */
+class BIOMEMAPPER_API FTerrainStencil
+{
+public:
+    /** Cells per tile of rows. */
+    static constexpr int32 TILE_CELLS = 16384;
+
+    /**
+     * Precomputes the stencil weights of every row from the metric cell spacing. Rows are
+     * 1 / Resolution.X degrees of latitude apart and columns 1 / Resolution.Y degrees of
+     * longitude, which shrink with the cosine of the row's latitude. Grids without a
+     * resolution use a spacing of one in both directions, i.e. cell units.
+     * @param Grid - The climate grid, with its RowLatitude and Resolution.
+     * @param OutWeights - One entry per grid row.
+     */
+    static void CalculateRowWeights(const FClimateGrid& Grid, TArray<FStencilWeights>& OutWeights);
+
+    /**
+     * Splits the rows of a plane into tiles and runs them in parallel.
+     * @param TileFunction - Called as TileFunction(FirstRow, LastRow) for each tile, LastRow exclusive.
+     */
+    template <typename FTileFunction>
+    static void ForEachTile(int32 Width, int32 Height, FTileFunction&& TileFunction)
+    {
+        const int32 RowsPerTile = FMath::Max(TILE_CELLS / FMath::Max(Width, 1), 1);
+        const int32 NumTiles = FMath::DivideAndRoundUp(Height, RowsPerTile);
+
+        ParallelFor(NumTiles, [&](int32 Tile)
+        {
+            const int32 FirstRow = Tile * RowsPerTile;
+            TileFunction(FirstRow, FMath::Min(FirstRow + RowsPerTile, Height));
+        });
+    }
+
+    /** The input rows around row Y of a plane. */
+    static FStencilRows GetRows(const float* Plane, int32 Width, int32 Height, int32 Y)
+    {
+        FStencilRows Rows;
+        Rows.Above = Plane + static_cast<int64>(FMath::Max(Y - 1, 0)) * Width;
+        Rows.Center = Plane + static_cast<int64>(Y) * Width;
+        Rows.Below = Plane + static_cast<int64>(FMath::Min(Y + 1, Height - 1)) * Width;
+        Rows.Width = Width;
+        return Rows;
+    }
+
+    /** Calls CellFunction(X, Window) for the interior columns of a row. */
+    template <typename FCellFunction>
+    FORCEINLINE static void ForEachInteriorCell(const FStencilRows& Rows, FCellFunction&& CellFunction)
+    {
+        for (int32 X = 1; X < Rows.Width - 1; ++X)
+        {
+            CellFunction(X, Rows.GetWindow(X));
+        }
+    }
+
+    /** Calls CellFunction(X, Window) for the first and last column of a row. */
+    template <typename FCellFunction>
+    static void ForEachBorderCell(const FStencilRows& Rows, FCellFunction&& CellFunction)
+    {
+        CellFunction(0, Rows.GetBorderWindow(0));
+        if (Rows.Width > 1)
+        {
+            CellFunction(Rows.Width - 1, Rows.GetBorderWindow(Rows.Width - 1));
+        }
+    }
+
+    /** Calls CellFunction(X, Window) for every column of a row. */
+    template <typename FCellFunction>
+    FORCEINLINE static void ForEachCell(const FStencilRows& Rows, FCellFunction&& CellFunction)
+    {
+        ForEachInteriorCell(Rows, CellFunction);
+        ForEachBorderCell(Rows, CellFunction);
+    }
+
+    /**
+     * Horn's third-order finite difference gradient, dz/dx along the row and dz/dy towards
+     * the next row, in meters of elevation per meter.
+     */
+    FORCEINLINE static FVector2f HornGradient(const FTerrainWindow& W, const FStencilWeights& Weights)
+    {
+        return FVector2f(
+            ((W.C + 2.0f * W.F + W.I) - (W.A + 2.0f * W.D + W.G)) * Weights.HornX,
+            ((W.G + 2.0f * W.H + W.I) - (W.A + 2.0f * W.B + W.C)) * Weights.HornY);
+    }
+
+    /**
+     * Zevenbergen-Thorne curvature in 1/m, minus the sum of the second differences along the row
+     * and across it: -((W.D + W.F - 2 W.E) / dx^2 + (W.B + W.H - 2 W.E) / dy^2). Positive on
+     * convex cells such as ridges, negative on concave ones such as valleys.
+     */
+    FORCEINLINE static float Curvature(const FTerrainWindow& W, const FStencilWeights& Weights)
+    {
+        return -((W.D + W.F - 2.0f * W.E) * Weights.CurvatureX + (W.B + W.H - 2.0f * W.E) * Weights.CurvatureY);
+    }
+
+    /** Roughness, the elevation range of the window, in meters. */
+    FORCEINLINE static float Roughness(const FTerrainWindow& W)
+    {
+        const float Max = FMath::Max3(FMath::Max3(W.A, W.B, W.C), FMath::Max3(W.D, W.E, W.F), FMath::Max3(W.G, W.H, W.I));
+        const float Min = FMath::Min3(FMath::Min3(W.A, W.B, W.C), FMath::Min3(W.D, W.E, W.F), FMath::Min3(W.G, W.H, W.I));
+        return Max - Min;
+    }
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BiomeSimulationContext.h"
+#include "BiomeLookupTable.h"
+
+/**
+ * Settings for the out-of-core tiled pipeline.
+ */
+struct BIOMEMAPPER_API FTiledPipelineSettings
+{
+    /** Upper bound on the memory used for tile working data, in bytes. */
+    int64 MemoryBudgetBytes = 2048ll * 1024 * 1024;
+
+    /**
+     * Border cells loaded around each tile. Only the 3x3 terrain stencils read past the tile
+     * edge; the distance to ocean is found over the whole heightmap in a streaming pre-pass.
+     */
+    int32 HaloSize = 1;
+
+    /** Edge length of a tile in cells. 0 picks the largest tile that fits the memory budget. */
+    int32 TileSize = 0;
+
+    /** Directory the full-size result planes are written to. */
+    FString OutputDirectory;
+
+    /** Compiled classification mode. */
+    FBiomeLookupTableSettings LookupTable;
+};
+
+/**
+ * Runs the parse -> slope/climate -> classification pipeline over a heightmap in
+ * fixed-size tiles with halo borders, so maps larger than memory can be processed.
+ * A streaming pre-pass first finds the nearest ocean cell of every cell over the whole
+ * heightmap and spills it to a temporary file in the output directory, 8 bytes per cell,
+ * so tiles get the same ocean distances as an in-core run.
+ * Results are written to disk tile by tile as full-size row-major planes:
+ *   BiomeId.r8 (EBiomeId per cell), Altitude.r32, Temperature.r32, Precipitation.r32,
+ * each with a matching .hdr file describing its dimensions. BiomePalette.csv maps
+ * biome IDs to names and colors, and BiomeLatitudeBands.csv breaks coverage down by latitude.
+ */
+class BIOMEMAPPER_API FTiledBiomePipeline
+{
+public:
+    /**
+     * Processes a heightmap tile by tile.
+     * Raw heightmaps (R16, R32) are streamed from a memory mapping; image heightmaps
+     * cannot be decoded partially and are loaded as a single sample plane first.
+     * @param FilePath - Path to the heightmap file.
+     * @param Context - The run's planet, time and input parameters.
+     * @param Settings - Tiling, memory budget and output settings.
+     * @param OutSummary - Detected biomes, their occurrence counts and area coverage.
+     * @return True if every tile was processed and written.
+     */
+    static bool Run(
+        const FString& FilePath,
+        const FBiomeSimulationContext& Context,
+        const FTiledPipelineSettings& Settings,
+        FString& OutSummary);
+
+    /**
+     * Estimated working memory per cell of a tile (including halo), in bytes.
+     */
+    static int64 GetEstimatedBytesPerCell();
+
+    /**
+     * Picks the tile edge length for the given settings.
+     * @return The tile size, or 0 if the memory budget cannot hold a tile plus its halo.
+     */
+    static int32 ComputeTileSize(const FTiledPipelineSettings& Settings);
+
+    /**
+     * Writes a whole in-memory plane in the pipeline's output format, so in-core runs
+     * produce files interchangeable with tiled ones.
+     * @param Directory - Output directory.
+     * @param FileName - Plane file name, e.g. Temperature.r32; the .hdr is written beside it.
+     * @param Data - Row-major plane data.
+     * @param Width - Plane width in cells.
+     * @param Height - Plane height in cells.
+     * @param BitDepth - Bits per cell.
+     * @return True if the plane and its header were written.
+     */
+    static bool WritePlane(const FString& Directory, const FString& FileName, const void* Data, int32 Width, int32 Height, int32 BitDepth);
+
+    /** Writes BiomePalette.csv, mapping biome IDs to names and colors, into a directory. */
+    static bool WriteBiomePalette(const FString& Directory);
+};
@@ -1,5 +1,4 @@
 #include "BiomeEditorToolkit.h"
-#include "PlanetTime.h"
 #include "BiomeInputShared.h"
 #include "HeaderFooterWidget.h"
 #include "MainWidget.h"
@@ -9,21 +8,54 @@
 #include "BiomeCalculator.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Text/STextBlock.h"
+#include "Widgets/Notifications/SProgressBar.h"
 #include "DesktopPlatformModule.h"
 #include "HeightmapParser.h"
 #include "Engine/Texture2D.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
 #include "IImageWrapper.h"
 #include "IImageWrapperModule.h"
 #include "Modules/ModuleManager.h"
 #include "Misc/FileHelper.h"
 
-FInputParameters InputParams;
+namespace
+{
+    /** Inputs and outputs of a background heightmap load, owned by the job until it hands them back. */
+    struct FHeightmapLoadJob
+    {
+        FString FilePath;
+        FBiomeSimulationContext Context;
+        FClimateGrid Grid;
+        float MinLongitude = 0.0f;
+        float MaxLongitude = 0.0f;
+        int32 Width = 0;
+        int32 Height = 0;
+        FVector2D Resolution;
+        bool bSucceeded = false;
+        FTextureMipChain Preview;
+    };
+
+    /** Inputs and outputs of a background biome calculation. */
+    struct FBiomeCalculationJob
+    {
+        FBiomeSimulationContext Context;
+        TSharedPtr<FClimateGrid, ESPMode::ThreadSafe> SourceGrid;
+        FClimateGrid Grid;
+        float MinLongitude = 0.0f;
+        float MaxLongitude = 0.0f;
+        FString Results;
+    };
+}
 
 void BiomeEditorToolkit::Construct(const FArguments& InArgs)
 {
+    // Rooted so the garbage collector leaves it alone while a background job uses it
     BiomeCalculatorInstance = NewObject<UBiomeCalculator>();
+    BiomeCalculatorInstance->AddToRoot();
 
     // Initialize MainWidget properly
     SAssignNew(MainWidget, SMainWidget)
@@ -61,9 +93,167 @@ void BiomeEditorToolkit::Construct(const FArguments& InArgs)
                     .Padding(10)
                     [
                         SNew(SButtonRowWidget)
+                        .IsEnabled(this, &BiomeEditorToolkit::IsIdle)
                         .OnUploadHeightmap(FSimpleDelegate::CreateRaw(this, &BiomeEditorToolkit::OnUploadButtonClicked))
                         .OnCalculateBiome(FSimpleDelegate::CreateRaw(this, &BiomeEditorToolkit::OnCalculateBiomeClicked))
                     ]
+
+                    // Classification options
+                    + SVerticalBox::Slot()
+                    .AutoHeight()
+                    .Padding(10, 0)
+                    [
+                        SNew(SVerticalBox)
+                        .IsEnabled(this, &BiomeEditorToolkit::IsIdle)
+
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(0, 2)
+                        [
+                            SNew(SCheckBox)
+                            .IsChecked(this, &BiomeEditorToolkit::GetLookupTableState)
+                            .OnCheckStateChanged(this, &BiomeEditorToolkit::OnLookupTableChanged)
+                            .ToolTipText(FText::FromString("Classify cells with a compiled lookup table instead of evaluating the rules per cell"))
+                            [
+                                SNew(STextBlock)
+                                .Text(FText::FromString("Compiled lookup table"))
+                            ]
+                        ]
+
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(20, 2, 0, 2)
+                        [
+                            SNew(SCheckBox)
+                            .IsEnabled_Lambda([this]() { return LookupTableSettings.bEnabled; })
+                            .IsChecked(this, &BiomeEditorToolkit::GetValidateLookupTableState)
+                            .OnCheckStateChanged(this, &BiomeEditorToolkit::OnValidateLookupTableChanged)
+                            .ToolTipText(FText::FromString("Also run the exact classification and log the cells where the table differs"))
+                            [
+                                SNew(STextBlock)
+                                .Text(FText::FromString("Validate lookup table"))
+                            ]
+                        ]
+
+                        // Per-cell data export
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(0, 2)
+                        [
+                            SNew(SCheckBox)
+                            .IsChecked(this, &BiomeEditorToolkit::GetExportState)
+                            .OnCheckStateChanged(this, &BiomeEditorToolkit::OnExportChanged)
+                            .ToolTipText(FText::FromString("Write per-cell climate and biome data after each calculation"))
+                            [
+                                SNew(STextBlock)
+                                .Text(FText::FromString("Export per-cell data"))
+                            ]
+                        ]
+
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(20, 2, 0, 2)
+                        [
+                            SNew(SCheckBox)
+                            .IsEnabled_Lambda([this]() { return ExportSettings.bEnabled; })
+                            .IsChecked(this, &BiomeEditorToolkit::GetColumnarExportState)
+                            .OnCheckStateChanged(this, &BiomeEditorToolkit::OnColumnarExportChanged)
+                            .ToolTipText(FText::FromString("One binary file per column instead of a CSV"))
+                            [
+                                SNew(STextBlock)
+                                .Text(FText::FromString("Binary columns"))
+                            ]
+                        ]
+
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(20, 2, 0, 2)
+                        [
+                            SNew(SHorizontalBox)
+                            .IsEnabled_Lambda([this]() { return ExportSettings.bEnabled; })
+
+                            + SHorizontalBox::Slot()
+                            .AutoWidth()
+                            .VAlign(VAlign_Center)
+                            .Padding(0, 0, 10, 0)
+                            [
+                                SNew(STextBlock)
+                                .Text(FText::FromString("Columns:"))
+                            ]
+
+                            + SHorizontalBox::Slot()
+                            .FillWidth(1.0f)
+                            [
+                                SNew(SEditableTextBox)
+                                .Text_Lambda([this]() { return FText::FromString(ExportColumnNames); })
+                                .HintText(FText::FromString("Default, All, or e.g. Latitude,Longitude,Biome"))
+                                .OnTextCommitted_Lambda([this](const FText& Text, ETextCommit::Type) { ExportColumnNames = Text.ToString(); })
+                            ]
+                        ]
+
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(20, 2, 0, 2)
+                        [
+                            SNew(SHorizontalBox)
+                            .IsEnabled_Lambda([this]() { return ExportSettings.bEnabled; })
+
+                            + SHorizontalBox::Slot()
+                            .AutoWidth()
+                            .VAlign(VAlign_Center)
+                            .Padding(0, 0, 10, 0)
+                            [
+                                SNew(STextBlock)
+                                .Text(FText::FromString("Output:"))
+                            ]
+
+                            + SHorizontalBox::Slot()
+                            .FillWidth(1.0f)
+                            [
+                                SNew(SEditableTextBox)
+                                .Text_Lambda([this]() { return FText::FromString(ExportSettings.OutputPath); })
+                                .HintText(FText::FromString("BiomeDataLog.csv or BiomeData/ in the project directory"))
+                                .OnTextCommitted_Lambda([this](const FText& Text, ETextCommit::Type) { ExportSettings.OutputPath = Text.ToString().TrimStartAndEnd(); })
+                            ]
+                        ]
+                    ]
+
+                    // Progress of the running job, hidden when idle
+                    + SVerticalBox::Slot()
+                    .AutoHeight()
+                    .Padding(10, 0)
+                    [
+                        SNew(SVerticalBox)
+                        .Visibility(this, &BiomeEditorToolkit::GetJobVisibility)
+
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        [
+                            SNew(STextBlock)
+                            .Text(this, &BiomeEditorToolkit::GetJobStageText)
+                        ]
+
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(0, 5)
+                        [
+                            SNew(SProgressBar)
+                            .Percent(this, &BiomeEditorToolkit::GetJobPercent)
+                        ]
+
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .HAlign(HAlign_Center)
+                        [
+                            SNew(SBox)
+                            .WidthOverride(150.0f)
+                            [
+                                SNew(SButton)
+                                .Text(FText::FromString("Cancel"))
+                                .OnClicked(this, &BiomeEditorToolkit::OnCancelJobClicked)
+                            ]
+                        ]
+                    ]
                 ]
             ]
 
@@ -87,7 +277,7 @@ void BiomeEditorToolkit::Construct(const FArguments& InArgs)
                 .FillHeight(1.0f)
                 .Padding(0, 10)
                 [
-                    SAssignNew(ResultsWidget, SResultsWidget, HeightmapData, Width, Height)
+                    SAssignNew(ResultsWidget, SResultsWidget)
                 ]
                 
             ]    
@@ -98,22 +288,14 @@ void BiomeEditorToolkit::Construct(const FArguments& InArgs)
 
 void BiomeEditorToolkit::OnUploadButtonClicked()
 {
-    // Initialize PlanetTime with user inputs
-    float DayLengthHours = DayLength; // Default or fetch from user input
-    float YearDuration = YearLength;    // Default or fetch from user input
-    int32 Date = DayOfYear;
-
-    // Populate InputParams with current values
-    InputParams.NorthernLatitude = MainWidget->GetNorthernLatitude();
-    InputParams.SouthernLatitude = MainWidget->GetSouthernLatitude();
-    InputParams.CentralLongitude = MainWidget->GetCentralLongitude();
-    InputParams.MaximumAltitude = MainWidget->GetMaximumAltitude();
-    InputParams.MinimumAltitude = MainWidget->GetMinimumAltitude();
-    InputParams.SeaLevel = MainWidget->GetSeaLevel();
-
-    // Initialize the PlanetTime singleton
-    FPlanetTime::Initialize(YearDuration, DayLength, 0.0f, Date, 0.0f);
-    
+    if (!IsIdle())
+    {
+        return;
+    }
+
+    // Planet, time and inputs as currently set, captured for this load
+    const FBiomeSimulationContext Context = GetSimulationContext();
+
     IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
     if (!DesktopPlatform)
     {
@@ -136,36 +318,91 @@ void BiomeEditorToolkit::OnUploadButtonClicked()
     {
         if (OutFiles.Num() > 0)
         {
-            FString SelectedFile = OutFiles[0];
-            this->HeightmapData.Empty();
-
-            if (!UHeightmapParser::ParseHeightmap(
-                SelectedFile,
-                InputParams,
-                ParsedMinLongitude,
-                ParsedMaxLongitude,
-                this->HeightmapData,
-                this->Width,
-                this->Height,
-                Resolution))
+            const TSharedRef<FBiomeJobProgress, ESPMode::ThreadSafe> Progress = MakeShared<FBiomeJobProgress, ESPMode::ThreadSafe>(5);
+            const TSharedRef<FHeightmapLoadJob, ESPMode::ThreadSafe> Job = MakeShared<FHeightmapLoadJob, ESPMode::ThreadSafe>();
+            Job->FilePath = OutFiles[0];
+            Job->Context = Context;
+
+            // The ocean proximity cache travels with the job so an unchanged coastline is not searched again;
+            // the loaded grid stays usable until the new one replaces it
+            Job->Grid.OceanProximity = MoveTemp(OceanProximity);
+
+            if (ResultsWidget.IsValid())
             {
-                if (ResultsWidget.IsValid())
-                {
-                    ResultsWidget->UpdateResults(FString::Printf(TEXT("Failed to parse heightmap: %s"), *SelectedFile));
-                }
-                UE_LOG(LogTemp, Error, TEXT("Failed to parse heightmap: %s"), *SelectedFile);
+                ResultsWidget->UpdateResults(FString::Printf(TEXT("Loading heightmap: %s"), *Job->FilePath));
             }
-            else
-            {
-                UTexture2D* HeightmapTexture = CreateHeightmapTexture(HeightmapData, Width, Height);
 
-                if (ResultsWidget.IsValid())
+            ActiveJob = Progress;
+            const TWeakPtr<BiomeEditorToolkit> WeakThis = StaticCastSharedRef<BiomeEditorToolkit>(AsShared());
+
+            ActiveTask = Async(EAsyncExecution::ThreadPool, [WeakThis, Progress, Job]()
+            {
+                Job->bSucceeded = UHeightmapParser::ParseHeightmap(
+                    Job->FilePath,
+                    Job->Context,
+                    Job->MinLongitude,
+                    Job->MaxLongitude,
+                    Job->Grid,
+                    Job->Width,
+                    Job->Height,
+                    Job->Resolution,
+                    &Progress.Get());
+
+                if (Job->bSucceeded && !Progress->IsCancelled())
                 {
-                    ResultsWidget->UpdateHeightmapTexture(HeightmapTexture);
-                    ResultsWidget->UpdateResults(FString::Printf(TEXT("Loaded heightmap (%dx%d)"), Width, Height));
+                    Progress->BeginStage(TEXT("Building preview"));
+                    BuildHeightmapPreview(Job->Grid, Job->Context.InputParams, Job->Preview);
                 }
-                UE_LOG(LogTemp, Log, TEXT("Successfully loaded heightmap: %s"), *SelectedFile);
-            }
+
+                // Textures and widgets are only touched on the game thread
+                AsyncTask(ENamedThreads::GameThread, [WeakThis, Progress, Job]()
+                {
+                    const TSharedPtr<BiomeEditorToolkit> This = WeakThis.Pin();
+                    if (!This.IsValid())
+                    {
+                        return;
+                    }
+
+                    This->ActiveJob.Reset();
+                    This->OceanProximity = MoveTemp(Job->Grid.OceanProximity);
+
+                    if (Progress->IsCancelled())
+                    {
+                        if (This->ResultsWidget.IsValid())
+                        {
+                            This->ResultsWidget->UpdateResults(TEXT("Heightmap load cancelled."));
+                        }
+                        UE_LOG(LogTemp, Log, TEXT("Heightmap load cancelled: %s"), *Job->FilePath);
+                    }
+                    else if (!Job->bSucceeded)
+                    {
+                        This->ClimateGrid.Reset();
+                        if (This->ResultsWidget.IsValid())
+                        {
+                            This->ResultsWidget->UpdateResults(FString::Printf(TEXT("Failed to parse heightmap: %s"), *Job->FilePath));
+                        }
+                        UE_LOG(LogTemp, Error, TEXT("Failed to parse heightmap: %s"), *Job->FilePath);
+                    }
+                    else
+                    {
+                        This->ClimateGrid = MakeShared<FClimateGrid, ESPMode::ThreadSafe>(MoveTemp(Job->Grid));
+                        This->ParsedMinLongitude = Job->MinLongitude;
+                        This->ParsedMaxLongitude = Job->MaxLongitude;
+                        This->Width = Job->Width;
+                        This->Height = Job->Height;
+                        This->Resolution = Job->Resolution;
+
+                        UTexture2D* HeightmapTexture = Job->Preview.CreateTexture();
+
+                        if (This->ResultsWidget.IsValid())
+                        {
+                            This->ResultsWidget->UpdateHeightmapTexture(HeightmapTexture);
+                            This->ResultsWidget->UpdateResults(FString::Printf(TEXT("Loaded heightmap (%dx%d)"), Job->Width, Job->Height));
+                        }
+                        UE_LOG(LogTemp, Log, TEXT("Successfully loaded heightmap: %s"), *Job->FilePath);
+                    }
+                });
+            });
         }
     }
     else
@@ -177,66 +414,76 @@ void BiomeEditorToolkit::OnUploadButtonClicked()
     }
 }
 
-UTexture2D* BiomeEditorToolkit::CreateHeightmapTexture(const TArray<FHeightmapCell>& MapData, int32 HeightmapWidth, int32 HeightmapHeight)
+void BiomeEditorToolkit::BuildHeightmapPreview(const FClimateGrid& Grid, const FInputParameters& Params, FTextureMipChain& OutPreview)
 {
     // Define the target size
     constexpr int32 MaxTargetSize = 1024;
 
+    // Samples per axis averaged into each preview pixel when downscaling; enough to suppress
+    // aliasing without reading every cell of a 16k map
+    constexpr int32 MaxSamplesPerAxis = 4;
+
     // Calculate scale factor to fit within MaxTargetSize
-    float ScaleFactor = FMath::Min(MaxTargetSize / static_cast<float>(HeightmapWidth), 
-                                   MaxTargetSize / static_cast<float>(HeightmapHeight));
-    int32 ScaledWidth = FMath::RoundToInt(HeightmapWidth * ScaleFactor);
-    int32 ScaledHeight = FMath::RoundToInt(HeightmapHeight * ScaleFactor);
+    const float ScaleFactor = FMath::Min(MaxTargetSize / static_cast<float>(Grid.Width),
+                                         MaxTargetSize / static_cast<float>(Grid.Height));
+    const int32 PreviewWidth = FMath::Max(FMath::RoundToInt(Grid.Width * ScaleFactor), 1);
+    const int32 PreviewHeight = FMath::Max(FMath::RoundToInt(Grid.Height * ScaleFactor), 1);
 
+    // Footprint of one preview pixel in source cells
+    const float StepX = Grid.Width / static_cast<float>(PreviewWidth);
+    const float StepY = Grid.Height / static_cast<float>(PreviewHeight);
+    const int32 SamplesX = FMath::Clamp(FMath::CeilToInt(StepX), 1, MaxSamplesPerAxis);
+    const int32 SamplesY = FMath::Clamp(FMath::CeilToInt(StepY), 1, MaxSamplesPerAxis);
+    const float InvNumSamples = 1.0f / (SamplesX * SamplesY);
 
-    TArray<FColor> TextureData;
-    TextureData.Reserve(ScaledWidth * ScaledHeight);
+    const float AltitudeScale = 255.0f / (Params.MaximumAltitude - Params.MinimumAltitude);
 
-    for (int32 y = 0; y < ScaledHeight; ++y)
+    OutPreview.Init(PreviewWidth, PreviewHeight, true);
+    FColor* Preview = OutPreview.GetLevel(0);
+
+    ParallelFor(PreviewHeight, [&](int32 y)
     {
-        for (int32 x = 0; x < ScaledWidth; ++x)
+        for (int32 x = 0; x < PreviewWidth; ++x)
         {
-            // Map scaled coordinates back to original data
-            float OriginalX = x / ScaleFactor;
-            float OriginalY = y / ScaleFactor;
+            // Bilinear samples spread evenly over the pixel's footprint, averaged as a box filter
+            float Altitude = 0.0f;
+            for (int32 sy = 0; sy < SamplesY; ++sy)
+            {
+                const float SourceY = FMath::Clamp((y + (sy + 0.5f) / SamplesY) * StepY - 0.5f, 0.0f, Grid.Height - 1.0f);
+                const int32 Y0 = FMath::FloorToInt(SourceY);
+                const int32 Y1 = FMath::Min(Y0 + 1, Grid.Height - 1);
+                const float FracY = SourceY - Y0;
 
-            int32 BaseX = FMath::Clamp(FMath::FloorToInt(OriginalX), 0, HeightmapWidth - 1);
-            int32 BaseY = FMath::Clamp(FMath::FloorToInt(OriginalY), 0, HeightmapHeight - 1);
+                for (int32 sx = 0; sx < SamplesX; ++sx)
+                {
+                    const float SourceX = FMath::Clamp((x + (sx + 0.5f) / SamplesX) * StepX - 0.5f, 0.0f, Grid.Width - 1.0f);
+                    const int32 X0 = FMath::FloorToInt(SourceX);
+                    const int32 X1 = FMath::Min(X0 + 1, Grid.Width - 1);
+                    const float FracX = SourceX - X0;
+
+                    const float Top = FMath::Lerp(Grid.Altitude[Y0 * Grid.Width + X0], Grid.Altitude[Y0 * Grid.Width + X1], FracX);
+                    const float Bottom = FMath::Lerp(Grid.Altitude[Y1 * Grid.Width + X0], Grid.Altitude[Y1 * Grid.Width + X1], FracX);
+                    Altitude += FMath::Lerp(Top, Bottom, FracY);
+                }
+            }
 
-            // Bilinear interpolation between four nearest pixels
-            const FHeightmapCell& Cell = MapData[BaseY * HeightmapWidth + BaseX];
-            uint8 GrayValue = static_cast<uint8>(FMath::Clamp((Cell.Altitude - InputParams.MinimumAltitude) / (InputParams.MaximumAltitude - InputParams.MinimumAltitude) * 255.0f, 0.0f, 255.0f));
-            TextureData.Add(FColor(GrayValue, GrayValue, GrayValue, 255));
+            const uint8 GrayValue = static_cast<uint8>(FMath::Clamp((Altitude * InvNumSamples - Params.MinimumAltitude) * AltitudeScale, 0.0f, 255.0f));
+            Preview[y * PreviewWidth + x] = FColor(GrayValue, GrayValue, GrayValue, 255);
         }
-    }
-
-    UTexture2D* HeightmapTexture = UTexture2D::CreateTransient(ScaledWidth, ScaledHeight);
-    if (!HeightmapTexture)
-    {
-        return nullptr;
-    }
-
-    if (HeightmapTexture->GetPlatformData() == nullptr)
-    {
-        HeightmapTexture->SetPlatformData(new FTexturePlatformData());
-        HeightmapTexture->GetPlatformData()->SizeX = ScaledWidth;
-        HeightmapTexture->GetPlatformData()->SizeY = ScaledHeight;
-        HeightmapTexture->GetPlatformData()->PixelFormat = PF_B8G8R8A8;
-    }
-
-    FTexture2DMipMap& Mip = HeightmapTexture->GetPlatformData()->Mips[0];
-    Mip.BulkData.Lock(LOCK_READ_WRITE);
-    void* TextureMemory = Mip.BulkData.Realloc(ScaledWidth * ScaledHeight * sizeof(FColor));
-    FMemory::Memcpy(TextureMemory, TextureData.GetData(), TextureData.Num() * sizeof(FColor));
-    Mip.BulkData.Unlock();
+    });
 
-    HeightmapTexture->UpdateResource();
-    return HeightmapTexture;
+    // Full chain so the preview stays smooth when shown smaller than 1:1
+    OutPreview.GenerateMips();
 }
 
 void BiomeEditorToolkit::OnCalculateBiomeClicked()
 {
-    if (HeightmapData.Num() == 0)
+    if (!IsIdle())
+    {
+        return;
+    }
+
+    if (!ClimateGrid.IsValid() || ClimateGrid->Num() == 0)
     {
         if (ResultsWidget.IsValid())
         {
@@ -245,34 +492,97 @@ void BiomeEditorToolkit::OnCalculateBiomeClicked()
         return;
     }    
 
-    FString BiomeResults = BiomeCalculatorInstance->CalculateBiomeFromInput(
-        InputParams,
-        ParsedMinLongitude,
-        ParsedMaxLongitude,
-        HeightmapData);
+    const TSharedRef<FBiomeCalculationJob, ESPMode::ThreadSafe> Job = MakeShared<FBiomeCalculationJob, ESPMode::ThreadSafe>();
+    Job->Context = GetSimulationContext();
 
-    if (ResultsWidget.IsValid())
+    if (ExportSettings.bEnabled && !FBiomeDataExporter::ParseColumns(ExportColumnNames, ExportSettings.Columns))
     {
-        // Pass updated HeightmapData
-        ResultsWidget->UpdateHeightmapData(HeightmapData, Width, Height);  
-        ResultsWidget->UpdateResults(BiomeResults);       
-        
-    }   
+        if (ResultsWidget.IsValid())
+        {
+            ResultsWidget->UpdateResults(FString::Printf(TEXT("Unknown export columns: %s"), *ExportColumnNames));
+        }
+        return;
+    }
 
-    TArray<FColor> TextureData;
-    TextureData.Reserve(Width * Height);
+    // The calculator is only used by this job until it finishes
+    BiomeCalculatorInstance->LookupTableSettings = LookupTableSettings;
+    BiomeCalculatorInstance->ExportSettings = ExportSettings;
 
-    for (const FHeightmapCell& Cell : HeightmapData)
-    {
-        TextureData.Add(Cell.BiomeColor);
-    }
+    // The climate fields computed at load are kept: the climate pass does not read the planet time
+    // yet (Temperature::CalculateSolarInsolation uses a fixed declination), so only classification runs
+
+    Job->MinLongitude = ParsedMinLongitude;
+    Job->MaxLongitude = ParsedMaxLongitude;
 
-    UTexture2D* BiomeMapTexture = CreateBiomeMapTexture(TextureData, Width, Height);
+    const TSharedRef<FBiomeJobProgress, ESPMode::ThreadSafe> Progress = MakeShared<FBiomeJobProgress, ESPMode::ThreadSafe>(2);
 
+    // The results widget and its viewer let go of the published grid first, so the job can take it
+    // over instead of copying every plane only to rewrite the biome IDs; the map is shown again when
+    // the job finishes
     if (ResultsWidget.IsValid())
     {
-        ResultsWidget->UpdateBiomeMapTexture(BiomeMapTexture);
+        ResultsWidget->UpdateHeightmapData(nullptr);
+        ResultsWidget->UpdateResults(TEXT("Calculating biomes..."));
     }
+
+    // The grid is handed to the job, which gives back a new one when it finishes, cancelled or not
+    Job->SourceGrid = MoveTemp(ClimateGrid);
+
+    ActiveJob = Progress;
+    const TWeakPtr<BiomeEditorToolkit> WeakThis = StaticCastSharedRef<BiomeEditorToolkit>(AsShared());
+    UBiomeCalculator* Calculator = BiomeCalculatorInstance;
+
+    ActiveTask = Async(EAsyncExecution::ThreadPool, [WeakThis, Progress, Job, Calculator]()
+    {
+        // Take the grid over if nothing else references it; should anything still hold a published
+        // snapshot, work on a copy so it never changes underneath it
+        if (Job->SourceGrid.IsUnique())
+        {
+            Job->Grid = MoveTemp(*Job->SourceGrid);
+        }
+        else
+        {
+            Job->Grid = *Job->SourceGrid;
+        }
+        Job->SourceGrid.Reset();
+
+        if (!Progress->IsCancelled())
+        {
+            Job->Results = Calculator->CalculateBiomeFromInput(
+                Job->Context,
+                Job->MinLongitude,
+                Job->MaxLongitude,
+                Job->Grid,
+                &Progress.Get());
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Progress, Job]()
+        {
+            const TSharedPtr<BiomeEditorToolkit> This = WeakThis.Pin();
+            if (!This.IsValid())
+            {
+                return;
+            }
+
+            This->ActiveJob.Reset();
+            This->ClimateGrid = MakeShared<FClimateGrid, ESPMode::ThreadSafe>(MoveTemp(Job->Grid));
+
+            if (!This->ResultsWidget.IsValid())
+            {
+                return;
+            }
+
+            if (Progress->IsCancelled())
+            {
+                This->ResultsWidget->UpdateResults(TEXT("Biome calculation cancelled."));
+                return;
+            }
+
+            // Publish the grid; the biome map viewer builds its tiles from it on demand
+            This->ResultsWidget->UpdateHeightmapData(This->ClimateGrid);
+            This->ResultsWidget->UpdateResults(Job->Results);
+        });
+    });
 }
 
 float BiomeEditorToolkit::GetTimeOfYear()
@@ -283,23 +593,98 @@ float BiomeEditorToolkit::GetTimeOfYear()
     return Day / Year; // Normalized value between 0.0 and 1.0
 }
 
-UTexture2D* BiomeEditorToolkit::CreateBiomeMapTexture(const TArray<FColor>& TextureData, int32 TextureWidth, int32 TextureHeight)
+bool BiomeEditorToolkit::IsIdle() const
+{
+    return !ActiveJob.IsValid();
+}
+
+EVisibility BiomeEditorToolkit::GetJobVisibility() const
+{
+    return ActiveJob.IsValid() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+TOptional<float> BiomeEditorToolkit::GetJobPercent() const
 {
-    UTexture2D* Texture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PF_B8G8R8A8);
-    if (!Texture)
+    return ActiveJob.IsValid() ? ActiveJob->GetStageFraction() : 0.0f;
+}
+
+FText BiomeEditorToolkit::GetJobStageText() const
+{
+    if (!ActiveJob.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create biome map texture."));
-        return nullptr;
+        return FText::GetEmpty();
     }
 
-    FTexture2DMipMap& Mip = Texture->GetPlatformData()->Mips[0];
-    Mip.BulkData.Lock(LOCK_READ_WRITE);
-    void* Data = Mip.BulkData.Realloc(TextureWidth * TextureHeight * sizeof(FColor));
-    FMemory::Memcpy(Data, TextureData.GetData(), TextureData.Num() * sizeof(FColor));
-    Mip.BulkData.Unlock();
+    return FText::FromString(FString::Printf(TEXT("%s - %.0f%% overall%s"),
+        *ActiveJob->GetStageText(), 100.0f * ActiveJob->GetOverallFraction(),
+        ActiveJob->IsCancelled() ? TEXT(", cancelling...") : TEXT("")));
+}
 
-    Texture->UpdateResource();
-    return Texture;
+ECheckBoxState BiomeEditorToolkit::GetLookupTableState() const
+{
+    return LookupTableSettings.bEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void BiomeEditorToolkit::OnLookupTableChanged(ECheckBoxState NewState)
+{
+    LookupTableSettings.bEnabled = NewState == ECheckBoxState::Checked;
+}
+
+ECheckBoxState BiomeEditorToolkit::GetValidateLookupTableState() const
+{
+    return LookupTableSettings.bValidate ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void BiomeEditorToolkit::OnValidateLookupTableChanged(ECheckBoxState NewState)
+{
+    LookupTableSettings.bValidate = NewState == ECheckBoxState::Checked;
+}
+
+ECheckBoxState BiomeEditorToolkit::GetExportState() const
+{
+    return ExportSettings.bEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void BiomeEditorToolkit::OnExportChanged(ECheckBoxState NewState)
+{
+    ExportSettings.bEnabled = NewState == ECheckBoxState::Checked;
+}
+
+ECheckBoxState BiomeEditorToolkit::GetColumnarExportState() const
+{
+    return ExportSettings.Format == EBiomeDataFormat::Columnar ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void BiomeEditorToolkit::OnColumnarExportChanged(ECheckBoxState NewState)
+{
+    ExportSettings.Format = NewState == ECheckBoxState::Checked ? EBiomeDataFormat::Columnar : EBiomeDataFormat::CSV;
+}
+
+FReply BiomeEditorToolkit::OnCancelJobClicked()
+{
+    if (ActiveJob.IsValid())
+    {
+        ActiveJob->Cancel();
+    }
+    return FReply::Handled();
+}
+
+BiomeEditorToolkit::~BiomeEditorToolkit()
+{
+    // The job still uses the calculator, so it must stop before the calculator is released
+    if (ActiveJob.IsValid())
+    {
+        ActiveJob->Cancel();
+    }
+    if (ActiveTask.IsValid())
+    {
+        ActiveTask.Wait();
+    }
+
+    if (BiomeCalculatorInstance)
+    {
+        BiomeCalculatorInstance->RemoveFromRoot();
+    }
 }
 
 void BiomeEditorToolkit::OnShowHeightmapClicked()
@@ -318,16 +703,31 @@ void BiomeEditorToolkit::OnShowBiomeMapClicked()
     }
 }
 
-void BiomeEditorToolkit::OnParametersChanged()
+FBiomeSimulationContext BiomeEditorToolkit::GetSimulationContext() const
 {
+    FBiomeSimulationContext Context;
     if (MainWidget.IsValid())
     {
+        Context.PlanetTime = FPlanetTime(MainWidget->GetYearLengthDays(), MainWidget->GetDayLengthHours(), 0.0f,
+                                         FMath::RoundToInt(MainWidget->GetDayOfYear()), 0.0f);
+
+        FInputParameters& InputParams = Context.InputParams;
         InputParams.NorthernLatitude = MainWidget->GetNorthernLatitude();
         InputParams.SouthernLatitude = MainWidget->GetSouthernLatitude();
         InputParams.CentralLongitude = MainWidget->GetCentralLongitude();
         InputParams.MaximumAltitude = MainWidget->GetMaximumAltitude();
         InputParams.MinimumAltitude = MainWidget->GetMinimumAltitude();
         InputParams.SeaLevel = MainWidget->GetSeaLevel();
+    }
+    return Context;
+}
+
+void BiomeEditorToolkit::OnParametersChanged()
+{
+    if (MainWidget.IsValid())
+    {
+        const FBiomeSimulationContext Context = GetSimulationContext();
+        const FInputParameters& InputParams = Context.InputParams;
 
         UE_LOG(LogTemp, Log, TEXT("Parameters Changed:"));
         UE_LOG(LogTemp, Log, TEXT("Northern Latitude: %.2f"), InputParams.NorthernLatitude);
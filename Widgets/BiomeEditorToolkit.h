@@ -3,8 +3,12 @@
 #include "CoreMinimal.h"
 #include "ResultsWidget.h"
 #include "Widgets/SCompoundWidget.h"
-#include "HeightmapCell.h"
+#include "ClimateGrid.h"
 #include "BiomeCalculator.h"
+#include "BiomeJobProgress.h"
+#include "BiomeSimulationContext.h"
+#include "TextureMipChain.h"
+#include "Async/Future.h"
 
 class SButtonRowWidget;
 class SMainWidget;
@@ -22,6 +26,9 @@ public:
     /** Constructs the editor toolkit widget. */
     void Construct(const FArguments& InArgs);
 
+    /** Cancels a running job and waits for it before the toolkit goes away. */
+    virtual ~BiomeEditorToolkit();
+
 private:
     // Biome calculator instance
     UBiomeCalculator* BiomeCalculatorInstance;
@@ -47,14 +54,39 @@ private:
     /** Callback for when parameters are changed in the MainWidget */
     void OnParametersChanged();
 
-    // Texture creation methods
-    UTexture2D* CreateHeightmapTexture(const TArray<FHeightmapCell>& MapData, int32 HeightmapWidth, int32 HeightmapHeight);
-    UTexture2D* CreateBiomeMapTexture(const TArray<FColor>& TextureData, int32 TextureWidth, int32 TextureHeight);
+    /** Planet, time and input parameters currently set in the MainWidget. */
+    FBiomeSimulationContext GetSimulationContext() const;
+
+    // Background job state, bound to the progress bar and cancel button
+    bool IsIdle() const;
+    EVisibility GetJobVisibility() const;
+    TOptional<float> GetJobPercent() const;
+    FText GetJobStageText() const;
+    FReply OnCancelJobClicked();
+
+    // Classification options, handed to the calculator when a calculation starts
+    ECheckBoxState GetLookupTableState() const;
+    void OnLookupTableChanged(ECheckBoxState NewState);
+    ECheckBoxState GetValidateLookupTableState() const;
+    void OnValidateLookupTableChanged(ECheckBoxState NewState);
+    FBiomeLookupTableSettings LookupTableSettings;
+
+    // Per-cell data export, handed to the calculator with the columns parsed from ExportColumnNames
+    ECheckBoxState GetExportState() const;
+    void OnExportChanged(ECheckBoxState NewState);
+    ECheckBoxState GetColumnarExportState() const;
+    void OnColumnarExportChanged(ECheckBoxState NewState);
+    FBiomeDataExportSettings ExportSettings;
+    FString ExportColumnNames = TEXT("Default");
+
+    // Preview data is built on the load job's worker thread; the texture itself on the game thread
+    static void BuildHeightmapPreview(const FClimateGrid& Grid, const FInputParameters& Params, FTextureMipChain& OutPreview);
+
+    // Progress of the running heightmap load or biome calculation, null when idle
+    TSharedPtr<FBiomeJobProgress, ESPMode::ThreadSafe> ActiveJob;
+    TFuture<void> ActiveTask;
 
     // Helper variables for storing slider values
-    float DayLength = 24.0f;
-    float YearLength = 365.25;
-    float DayOfYear = 0.0f;    
     float NorthernLatitudeInput = 35.0f;
     float SouthernLatitudeInput = 25.0f;
     float CentralLongitudeInput = 0.0f;
@@ -62,8 +94,12 @@ private:
     float MaximumAltitudeInput = 2000.0f;
     float SeaLevelInput = 250.0f;
 
-    // Parsed heightmap data
-    TArray<FHeightmapCell> HeightmapData;
+    // Parsed heightmap data, also published to the results widget once classified; only modified
+    // by a job that holds the sole reference
+    TSharedPtr<FClimateGrid, ESPMode::ThreadSafe> ClimateGrid;
+
+    // Kept apart from the grid so the next load can reuse it while the grid is shared
+    FOceanProximityCache OceanProximity;
     float ParsedMinLongitude = 0.0f;
     float ParsedMaxLongitude = 0.0f;
 };
\ No newline at end of file
@@ -0,0 +1,346 @@
+#include "BiomeMapViewer.h"
+#include "TextureMipChain.h"
+#include "Async/ParallelFor.h"
+#include "Brushes/SlateImageBrush.h"
+#include "Engine/Texture2D.h"
+#include "Rendering/DrawElements.h"
+
+// Texels per tile side; tiles are small enough to build several per frame
+static constexpr int32 TILE_SIZE = 256;
+
+// Tiles built per frame at most, so zooming into a new area does not stall the editor
+static constexpr int32 MAX_TILE_BUILDS_PER_FRAME = 8;
+
+// Cached tiles at most, 256 KB each
+static constexpr int32 MAX_CACHED_TILES = 256;
+
+// Zoom range relative to fitting the whole map, and the closest zoom in screen units per cell
+static constexpr float MIN_ZOOM_FRACTION_OF_FIT = 0.5f;
+static constexpr float MAX_ZOOM = 32.0f;
+
+void SBiomeMapViewer::Construct(const FArguments& InArgs)
+{
+    OnCellHovered = InArgs._OnCellHovered;
+    SetClipping(EWidgetClipping::ClipToBounds);
+}
+
+void SBiomeMapViewer::SetGrid(const FClimateGridSnapshot& InGrid)
+{
+    Grid = InGrid;
+    Tiles.Empty();
+    HoveredCell = INDEX_NONE;
+    bFitPending = Grid.IsValid() && Grid->Num() > 0;
+}
+
+void SBiomeMapViewer::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+    ++FrameCounter;
+
+    const FVector2D ViewSize = AllottedGeometry.GetLocalSize();
+    if (!Grid.IsValid() || Grid->Num() == 0 || ViewSize.X <= 0.0f || ViewSize.Y <= 0.0f)
+    {
+        return;
+    }
+
+    if (bFitPending)
+    {
+        FitToView(ViewSize);
+    }
+
+    int32 BuildBudget = MAX_TILE_BUILDS_PER_FRAME;
+
+    // The coarse backdrop first, then the visible tiles at the zoom's level
+    RequestTile(FIntVector(0, 0, GetCoarsestLevel()), BuildBudget);
+
+    VisibleLevel = GetLevelForZoom();
+    const FIntRect Visible = GetVisibleTiles(VisibleLevel, ViewSize);
+    for (int32 TileY = Visible.Min.Y; TileY <= Visible.Max.Y; ++TileY)
+    {
+        for (int32 TileX = Visible.Min.X; TileX <= Visible.Max.X; ++TileX)
+        {
+            RequestTile(FIntVector(TileX, TileY, VisibleLevel), BuildBudget);
+        }
+    }
+
+    TrimCache();
+}
+
+int32 SBiomeMapViewer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+                               FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+                               bool bParentEnabled) const
+{
+    if (!Grid.IsValid() || Grid->Num() == 0)
+    {
+        return LayerId;
+    }
+
+    const int32 CoarsestLevel = GetCoarsestLevel();
+    DrawTile(FIntVector(0, 0, CoarsestLevel), AllottedGeometry, OutDrawElements, LayerId);
+
+    if (VisibleLevel != CoarsestLevel)
+    {
+        const FIntRect Visible = GetVisibleTiles(VisibleLevel, AllottedGeometry.GetLocalSize());
+        for (int32 TileY = Visible.Min.Y; TileY <= Visible.Max.Y; ++TileY)
+        {
+            for (int32 TileX = Visible.Min.X; TileX <= Visible.Max.X; ++TileX)
+            {
+                DrawTile(FIntVector(TileX, TileY, VisibleLevel), AllottedGeometry, OutDrawElements, LayerId + 1);
+            }
+        }
+    }
+
+    return LayerId + 1;
+}
+
+FVector2D SBiomeMapViewer::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+    return FVector2D(TILE_SIZE, TILE_SIZE);
+}
+
+FReply SBiomeMapViewer::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton || MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
+    {
+        bPanning = true;
+        return FReply::Handled().CaptureMouse(SharedThis(this));
+    }
+    return FReply::Unhandled();
+}
+
+FReply SBiomeMapViewer::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (bPanning)
+    {
+        bPanning = false;
+        return FReply::Handled().ReleaseMouseCapture();
+    }
+    return FReply::Unhandled();
+}
+
+FReply SBiomeMapViewer::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    FitToView(MyGeometry.GetLocalSize());
+    return FReply::Handled();
+}
+
+FReply SBiomeMapViewer::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (bPanning)
+    {
+        ViewOrigin -= MouseEvent.GetCursorDelta() / MyGeometry.Scale / Zoom;
+    }
+
+    const int32 Cell = GetCellAt(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()));
+    if (Cell != HoveredCell)
+    {
+        HoveredCell = Cell;
+        OnCellHovered.ExecuteIfBound(HoveredCell);
+    }
+
+    return FReply::Handled();
+}
+
+FReply SBiomeMapViewer::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    // Zoom about the cursor, keeping the cell under it in place
+    const FVector2D LocalPosition = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+    const FVector2D CellUnderCursor = ViewOrigin + LocalPosition / Zoom;
+
+    Zoom = FMath::Clamp(Zoom * FMath::Pow(1.25f, MouseEvent.GetWheelDelta()), FitZoom * MIN_ZOOM_FRACTION_OF_FIT, FMath::Max(MAX_ZOOM, FitZoom));
+    ViewOrigin = CellUnderCursor - LocalPosition / Zoom;
+
+    return FReply::Handled();
+}
+
+void SBiomeMapViewer::OnMouseLeave(const FPointerEvent& MouseEvent)
+{
+    SLeafWidget::OnMouseLeave(MouseEvent);
+
+    if (HoveredCell != INDEX_NONE)
+    {
+        HoveredCell = INDEX_NONE;
+        OnCellHovered.ExecuteIfBound(HoveredCell);
+    }
+}
+
+void SBiomeMapViewer::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    for (TPair<FIntVector, FTile>& Pair : Tiles)
+    {
+        Collector.AddReferencedObject(Pair.Value.Texture);
+    }
+}
+
+FString SBiomeMapViewer::GetReferencerName() const
+{
+    return TEXT("SBiomeMapViewer");
+}
+
+int32 SBiomeMapViewer::GetLevelForZoom() const
+{
+    // Each level halves the texels per cell; pick the finest level that is not magnified below one texel per pixel
+    const int32 Level = Zoom >= 1.0f ? 0 : FMath::FloorToInt(FMath::Log2(1.0f / Zoom));
+    return FMath::Clamp(Level, 0, GetCoarsestLevel());
+}
+
+int32 SBiomeMapViewer::GetCoarsestLevel() const
+{
+    const int32 MapSize = FMath::Max(Grid->Width, Grid->Height);
+
+    int32 Level = 0;
+    while ((TILE_SIZE << Level) < MapSize)
+    {
+        ++Level;
+    }
+    return Level;
+}
+
+FIntRect SBiomeMapViewer::GetVisibleTiles(int32 Level, const FVector2D& ViewSize) const
+{
+    const float TileCells = static_cast<float>(TILE_SIZE << Level);
+    const int32 NumTilesX = FMath::DivideAndRoundUp(Grid->Width, TILE_SIZE << Level);
+    const int32 NumTilesY = FMath::DivideAndRoundUp(Grid->Height, TILE_SIZE << Level);
+    const FVector2D ViewEnd = ViewOrigin + ViewSize / Zoom;
+
+    // An empty range (Max < Min) when the view is off the map
+    return FIntRect(
+        FMath::Max(FMath::FloorToInt(ViewOrigin.X / TileCells), 0),
+        FMath::Max(FMath::FloorToInt(ViewOrigin.Y / TileCells), 0),
+        FMath::Min(FMath::FloorToInt(ViewEnd.X / TileCells), NumTilesX - 1),
+        FMath::Min(FMath::FloorToInt(ViewEnd.Y / TileCells), NumTilesY - 1));
+}
+
+SBiomeMapViewer::FTile SBiomeMapViewer::BuildTile(const FIntVector& Key) const
+{
+    const int32 Level = Key.Z;
+    const int32 Step = 1 << Level;
+    const TArray<FColor>& Palette = FBiomeRegistry::GetPalette();
+
+    FTextureMipChain Texels;
+    Texels.Init(TILE_SIZE, TILE_SIZE, false);
+    FColor* Colors = Texels.GetLevel(0);
+
+    // One sample per texel at the centre of the cells it covers; biomes are categories, so they are not averaged.
+    // Texels beyond the map edge stay transparent.
+    ParallelFor(TILE_SIZE, [&](int32 Y)
+    {
+        const int32 FirstCellY = (Key.Y * TILE_SIZE + Y) * Step;
+        const int32 CellY = FMath::Min(FirstCellY + Step / 2, Grid->Height - 1);
+
+        for (int32 X = 0; X < TILE_SIZE; ++X)
+        {
+            const int32 FirstCellX = (Key.X * TILE_SIZE + X) * Step;
+            if (FirstCellX >= Grid->Width || FirstCellY >= Grid->Height)
+            {
+                Colors[Y * TILE_SIZE + X] = FColor::Transparent;
+                continue;
+            }
+
+            const int32 CellX = FMath::Min(FirstCellX + Step / 2, Grid->Width - 1);
+            Colors[Y * TILE_SIZE + X] = Palette[static_cast<int32>(Grid->BiomeId[CellY * Grid->Width + CellX])];
+        }
+    });
+
+    FTile Tile;
+    Tile.Texture = Texels.CreateTexture(TF_Nearest);
+    if (Tile.Texture)
+    {
+        Tile.Brush = MakeShared<FSlateImageBrush>(Tile.Texture, FVector2D(TILE_SIZE, TILE_SIZE));
+    }
+    return Tile;
+}
+
+void SBiomeMapViewer::RequestTile(const FIntVector& Key, int32& InOutBuildBudget)
+{
+    if (FTile* Tile = Tiles.Find(Key))
+    {
+        Tile->LastUsedFrame = FrameCounter;
+        return;
+    }
+
+    if (InOutBuildBudget > 0)
+    {
+        --InOutBuildBudget;
+
+        FTile& Tile = Tiles.Add(Key, BuildTile(Key));
+        Tile.LastUsedFrame = FrameCounter;
+    }
+}
+
+void SBiomeMapViewer::TrimCache()
+{
+    if (Tiles.Num() <= MAX_CACHED_TILES)
+    {
+        return;
+    }
+
+    // Tiles used this frame are never evicted, so a view needing more than the capacity keeps them all
+    Tiles.ValueSort([](const FTile& A, const FTile& B) { return A.LastUsedFrame > B.LastUsedFrame; });
+
+    TArray<FIntVector> Evicted;
+    int32 Index = 0;
+    for (const TPair<FIntVector, FTile>& Pair : Tiles)
+    {
+        if (Index++ >= MAX_CACHED_TILES && Pair.Value.LastUsedFrame != FrameCounter)
+        {
+            Evicted.Add(Pair.Key);
+        }
+    }
+
+    for (const FIntVector& Key : Evicted)
+    {
+        Tiles.Remove(Key);
+    }
+}
+
+void SBiomeMapViewer::FitToView(const FVector2D& ViewSize)
+{
+    bFitPending = false;
+    if (!Grid.IsValid() || Grid->Num() == 0)
+    {
+        return;
+    }
+
+    FitZoom = FMath::Min(ViewSize.X / Grid->Width, ViewSize.Y / Grid->Height);
+    Zoom = FitZoom;
+
+    // Centre the map
+    ViewOrigin = (FVector2D(Grid->Width, Grid->Height) - ViewSize / Zoom) * 0.5f;
+}
+
+void SBiomeMapViewer::DrawTile(const FIntVector& Key, const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const
+{
+    const FTile* Tile = Tiles.Find(Key);
+    if (Tile == nullptr || !Tile->Brush.IsValid())
+    {
+        return;
+    }
+
+    const float TileCells = static_cast<float>(TILE_SIZE << Key.Z);
+    const FVector2D Position = (FVector2D(Key.X, Key.Y) * TileCells - ViewOrigin) * Zoom;
+    const FVector2D Size(TileCells * Zoom, TileCells * Zoom);
+
+    FSlateDrawElement::MakeBox(
+        OutDrawElements,
+        LayerId,
+        AllottedGeometry.ToPaintGeometry(Size, FSlateLayoutTransform(Position)),
+        Tile->Brush.Get());
+}
+
+int32 SBiomeMapViewer::GetCellAt(const FVector2D& LocalPosition) const
+{
+    if (!Grid.IsValid() || Grid->Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const FVector2D Cell = ViewOrigin + LocalPosition / Zoom;
+    const int32 CellX = FMath::FloorToInt(Cell.X);
+    const int32 CellY = FMath::FloorToInt(Cell.Y);
+
+    if (CellX < 0 || CellY < 0 || CellX >= Grid->Width || CellY >= Grid->Height)
+    {
+        return INDEX_NONE;
+    }
+    return CellY * Grid->Width + CellX;
+}
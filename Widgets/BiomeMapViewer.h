@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimateGrid.h"
+#include "Widgets/SLeafWidget.h"
+#include "UObject/GCObject.h"
+
+class UTexture2D;
+struct FSlateBrush;
+
+DECLARE_DELEGATE_OneParam(FOnBiomeMapCellHovered, int32 /* CellIndex, INDEX_NONE outside the map */);
+
+/**
+ * Pan and zoom view of a biome map of any size.
+ * The map is cut into fixed-size tiles per level of detail; level L samples every 2^L-th cell.
+ * Only the tiles visible at the level matching the zoom are built, a few per frame, from the
+ * grid's biome IDs, and kept in an LRU cache. The single tile of the coarsest level is always
+ * drawn underneath, so panning never shows holes while finer tiles are built.
+ * Drag to pan, scroll to zoom, double-click to fit.
+ */
+class BIOMEMAPPER_API SBiomeMapViewer : public SLeafWidget, public FGCObject
+{
+public:
+    SLATE_BEGIN_ARGS(SBiomeMapViewer) {}
+        SLATE_EVENT(FOnBiomeMapCellHovered, OnCellHovered)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    /**
+     * Shows the biomes of a grid, fitted to the view. Cached tiles are dropped.
+     * @param InGrid - Shared grid to read biome IDs from. Null clears the view.
+     */
+    void SetGrid(const FClimateGridSnapshot& InGrid);
+
+    // SWidget interface
+    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+                          FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+                          bool bParentEnabled) const override;
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+    virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
+
+    // FGCObject interface
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual FString GetReferencerName() const override;
+
+private:
+    struct FTile
+    {
+        UTexture2D* Texture = nullptr;
+        TSharedPtr<FSlateBrush> Brush;
+        uint64 LastUsedFrame = 0;
+    };
+
+    /** Level whose tiles are closest to one texel per screen pixel at the current zoom. */
+    int32 GetLevelForZoom() const;
+
+    /** Coarsest level, where a single tile covers the whole map. */
+    int32 GetCoarsestLevel() const;
+
+    /** Inclusive range of tiles of a level that intersect the view. */
+    FIntRect GetVisibleTiles(int32 Level, const FVector2D& ViewSize) const;
+
+    /** Builds one tile's texture from the grid. */
+    FTile BuildTile(const FIntVector& Key) const;
+
+    /** Marks a tile as used this frame, building it if the frame's budget allows. */
+    void RequestTile(const FIntVector& Key, int32& InOutBuildBudget);
+
+    /** Drops the least recently used tiles beyond the cache capacity. */
+    void TrimCache();
+
+    void FitToView(const FVector2D& ViewSize);
+    void DrawTile(const FIntVector& Key, const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const;
+    int32 GetCellAt(const FVector2D& LocalPosition) const;
+
+    FClimateGridSnapshot Grid;
+
+    // Tiles by (X, Y, level)
+    TMap<FIntVector, FTile> Tiles;
+    uint64 FrameCounter = 0;
+
+    // Map cell at the widget's top left corner, and screen units per cell
+    FVector2D ViewOrigin = FVector2D::ZeroVector;
+    float Zoom = 1.0f;
+    float FitZoom = 1.0f;
+    bool bFitPending = false;
+
+    // Level the visible tiles were requested at, for painting
+    int32 VisibleLevel = 0;
+
+    bool bPanning = false;
+    int32 HoveredCell = INDEX_NONE;
+    FOnBiomeMapCellHovered OnCellHovered;
+};
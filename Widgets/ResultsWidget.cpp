@@ -1,15 +1,12 @@
 #include "ResultsWidget.h"
+#include "BiomeMapViewer.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/SBoxPanel.h"
 
-void SResultsWidget::Construct(const FArguments& InArgs, const TArray<FHeightmapCell>& InHeightmapData, int32 InWidth, int32 InHeight)
+void SResultsWidget::Construct(const FArguments& InArgs)
 {
-    HeightmapData = InHeightmapData;
-    Width = InWidth;
-    Height = InHeight;
-    
     ChildSlot
     [
         SNew(SVerticalBox)
@@ -46,15 +43,15 @@ void SResultsWidget::Construct(const FArguments& InArgs, const TArray<FHeightmap
                 ]
             ]
 
-            // Hydrology Image
+            // Biome Map Viewer
             + SWidgetSwitcher::Slot()
             [
                 SNew(SBox)
                 .WidthOverride(1024.0f)
                 .HeightOverride(1024.0f)
                 [
-                    SAssignNew(BiomeMapImage, SImage)
-                    .Image(BiomeMapBrush.Get())
+                    SAssignNew(BiomeMapViewer, SBiomeMapViewer)
+                    .OnCellHovered(this, &SResultsWidget::OnBiomeMapCellHovered)
                 ]
             ]
         ]
@@ -100,37 +97,6 @@ void SResultsWidget::UpdateHeightmapTexture(UTexture2D* HeightmapTexture)
     }
 }
 
-void SResultsWidget::UpdateBiomeMapTexture(UTexture2D* BiomeMapTexture)
-{
-    if (!BiomeMapTexture)
-    {
-        UE_LOG(LogTemp, Error, TEXT("BiomeMapTexture is null."));
-        return;
-    }
-
-    if (!BiomeMapBrush.IsValid())
-    {
-        BiomeMapBrush = MakeShareable(new FSlateImageBrush(BiomeMapTexture,
-            FVector2D(BiomeMapTexture->GetSizeX(), BiomeMapTexture->GetSizeY())));
-    }
-    else
-    {
-        BiomeMapBrush->SetResourceObject(BiomeMapTexture);
-        BiomeMapBrush->ImageSize = FVector2D(BiomeMapTexture->GetSizeX(), BiomeMapTexture->GetSizeY());
-    }
-
-    if (BiomeMapImage.IsValid())
-    {
-        BiomeMapImage->SetImage(BiomeMapBrush.Get());
-        UE_LOG(LogTemp, Log, TEXT("Biome map image updated with dimensions: %dx%d"),
-            BiomeMapTexture->GetSizeX(), BiomeMapTexture->GetSizeY());
-    }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("BiomeMapImage is not valid."));
-    }
-}
-
 void SResultsWidget::ShowHeightmap()
 {
     if (ImageSwitcher.IsValid())
@@ -147,47 +113,23 @@ void SResultsWidget::ShowBiomeMap()
     }
 }
 
-FReply SResultsWidget::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+void SResultsWidget::OnBiomeMapCellHovered(int32 CellIndex)
 {
-    FVector2D LocalMousePosition = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
-
-    // Get the size of the BiomeMap texture display area
-    FVector2D TextureDisplaySize = MyGeometry.GetLocalSize();
-
-    // Ensure the cursor is within the bounds of the BiomeMap
-    if (LocalMousePosition.X < 0.0f || LocalMousePosition.Y < 0.0f || 
-        LocalMousePosition.X >= TextureDisplaySize.X || 
-        LocalMousePosition.Y >= TextureDisplaySize.Y)
+    if (BiomeTypeText.IsValid())
     {
-        // Reset biome text if the cursor is outside the bounds
-        if (BiomeTypeText.IsValid())
-        {
-            BiomeTypeText->SetText(FText::FromString(TEXT("")));
-        }
-        return FReply::Handled();
+        // Reads the biome ID plane of the shared grid directly
+        BiomeTypeText->SetText(ClimateGrid.IsValid() && ClimateGrid->IsValidIndex(CellIndex)
+            ? FText::FromString(FBiomeRegistry::GetName(ClimateGrid->BiomeId[CellIndex]))
+            : FText::GetEmpty());
     }
-
-    // Map cursor position to BiomeMap grid dimensions
-    int32 GridX = FMath::Clamp(FMath::FloorToInt((LocalMousePosition.X / TextureDisplaySize.X) * Width), 0, Width - 1);
-    int32 GridY = FMath::Clamp(FMath::FloorToInt((LocalMousePosition.Y / TextureDisplaySize.Y) * Height), 0, Height - 1);
-
-    
-        int32 Index = GridY * Width + GridX;
-        if (HeightmapData.IsValidIndex(Index))
-        {
-            const FHeightmapCell& Cell = HeightmapData[Index];
-            if (BiomeTypeText.IsValid())
-            {
-                BiomeTypeText->SetText(FText::FromString(Cell.BiomeType));
-            }
-        }    
-
-    return FReply::Handled();
 }
 
-void SResultsWidget::UpdateHeightmapData(const TArray<FHeightmapCell>& NewHeightmapData, int32 NewWidth, int32 NewHeight)
+void SResultsWidget::UpdateHeightmapData(const FClimateGridSnapshot& NewGrid)
 {
-    HeightmapData = NewHeightmapData;
-    Width = NewWidth;
-    Height = NewHeight;
+    ClimateGrid = NewGrid;
+
+    if (BiomeMapViewer.IsValid())
+    {
+        BiomeMapViewer->SetGrid(ClimateGrid);
+    }
 }
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "HeightmapCell.h"
+#include "ClimateGrid.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Layout/SWidgetSwitcher.h"
 
+class SBiomeMapViewer;
+
 class BIOMEMAPPER_API SResultsWidget : public SCompoundWidget
 {
 public:
@@ -12,7 +14,7 @@ public:
     SLATE_END_ARGS()
 
     /** Constructs the widget */
-    void Construct(const FArguments& InArgs, const TArray<FHeightmapCell>& InHeightmapData, int32 InWidth, int32 InHeight);
+    void Construct(const FArguments& InArgs);
 
     /** Updates the displayed results. */
     void UpdateResults(const FString& ResultsText);
@@ -20,28 +22,26 @@ public:
      /** Updates the displayed heightmap texture. */
     void UpdateHeightmapTexture(UTexture2D* HeightmapTexture);
 
-    void UpdateBiomeMapTexture(UTexture2D* BiomeMapTexture); 
-
     // Tab switching functions
     void ShowHeightmap();
     void ShowBiomeMap();
 
-    FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent);
-    void UpdateHeightmapData(const TArray<FHeightmapCell>& NewHeightmapData, int32 NewWidth, int32 NewHeight);
+    /** Shows a classified grid in the biome map viewer and uses it for hover information. The grid is shared, not copied. */
+    void UpdateHeightmapData(const FClimateGridSnapshot& NewGrid);
     
 private:
-    TArray<FHeightmapCell> HeightmapData; // Declare HeightmapData here
-    int32 Width = 0;
-    int32 Height = 0;
+    /** Shows the biome of the cell under the cursor in the biome map viewer. */
+    void OnBiomeMapCellHovered(int32 CellIndex);
+
+    FClimateGridSnapshot ClimateGrid; // Grid queried for hover information
 
     // Result Display
     TSharedPtr<STextBlock> ResultsTextBlock;
     TSharedPtr<SWidgetSwitcher> ImageSwitcher; // For switching between images
     TSharedPtr<SImage> HeightmapImage;        // Heightmap display
-    TSharedPtr<SImage> BiomeMapImage;        // Biome Map display
+    TSharedPtr<SBiomeMapViewer> BiomeMapViewer; // Tiled biome map display
     TSharedPtr<STextBlock> BiomeTypeText;   // Biome Type Text display
     TSharedPtr<FSlateImageBrush> HeightmapBrush;   // Brush for heightmap
-    TSharedPtr<FSlateImageBrush> BiomeMapBrush;     // Brush for Biome Map
 
     
 };
\ No newline at end of file
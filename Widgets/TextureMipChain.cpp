@@ -0,0 +1,95 @@
+#include "TextureMipChain.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Texture2D.h"
+
+void FTextureMipChain::Init(int32 Width, int32 Height, bool bWithMips)
+{
+    LevelSizes.Reset();
+    LevelOffsets.Reset();
+
+    int64 NumTexels = 0;
+    FIntPoint Size(Width, Height);
+    while (true)
+    {
+        LevelSizes.Add(Size);
+        LevelOffsets.Add(NumTexels);
+        NumTexels += static_cast<int64>(Size.X) * Size.Y;
+
+        if (!bWithMips || (Size.X == 1 && Size.Y == 1))
+        {
+            break;
+        }
+        Size = FIntPoint(FMath::Max(Size.X / 2, 1), FMath::Max(Size.Y / 2, 1));
+    }
+
+    Texels.SetNumUninitialized(NumTexels);
+}
+
+void FTextureMipChain::GenerateMips()
+{
+    for (int32 Level = 1; Level < NumLevels(); ++Level)
+    {
+        const FIntPoint SourceSize = LevelSizes[Level - 1];
+        const FIntPoint TargetSize = LevelSizes[Level];
+        const FColor* Source = GetLevel(Level - 1);
+        FColor* Target = GetLevel(Level);
+
+        ParallelFor(TargetSize.Y, [&](int32 Y)
+        {
+            // Odd sizes and 1 pixel wide levels clamp to the last source row or column
+            const FColor* Row0 = Source + static_cast<int64>(FMath::Min(2 * Y, SourceSize.Y - 1)) * SourceSize.X;
+            const FColor* Row1 = Source + static_cast<int64>(FMath::Min(2 * Y + 1, SourceSize.Y - 1)) * SourceSize.X;
+            FColor* TargetRow = Target + static_cast<int64>(Y) * TargetSize.X;
+
+            for (int32 X = 0; X < TargetSize.X; ++X)
+            {
+                const int32 X0 = FMath::Min(2 * X, SourceSize.X - 1);
+                const int32 X1 = FMath::Min(2 * X + 1, SourceSize.X - 1);
+
+                // Rounded average of the four texels per channel
+                TargetRow[X] = FColor(
+                    (Row0[X0].R + Row0[X1].R + Row1[X0].R + Row1[X1].R + 2) >> 2,
+                    (Row0[X0].G + Row0[X1].G + Row1[X0].G + Row1[X1].G + 2) >> 2,
+                    (Row0[X0].B + Row0[X1].B + Row1[X0].B + Row1[X1].B + 2) >> 2,
+                    (Row0[X0].A + Row0[X1].A + Row1[X0].A + Row1[X1].A + 2) >> 2);
+            }
+        });
+    }
+}
+
+UTexture2D* FTextureMipChain::CreateTexture(TextureFilter Filter) const
+{
+    check(NumLevels() > 0);
+
+    const FIntPoint BaseSize = LevelSizes[0];
+    UTexture2D* Texture = UTexture2D::CreateTransient(BaseSize.X, BaseSize.Y, PF_B8G8R8A8);
+    if (!Texture)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to create %dx%d texture."), BaseSize.X, BaseSize.Y);
+        return nullptr;
+    }
+
+    // CreateTransient allocates level 0; the rest of the chain is added here
+    FTexturePlatformData* PlatformData = Texture->GetPlatformData();
+    for (int32 Level = 1; Level < NumLevels(); ++Level)
+    {
+        FTexture2DMipMap* Mip = new FTexture2DMipMap();
+        Mip->SizeX = LevelSizes[Level].X;
+        Mip->SizeY = LevelSizes[Level].Y;
+        PlatformData->Mips.Add(Mip);
+    }
+
+    for (int32 Level = 0; Level < NumLevels(); ++Level)
+    {
+        const int64 NumBytes = static_cast<int64>(LevelSizes[Level].X) * LevelSizes[Level].Y * sizeof(FColor);
+
+        FTexture2DMipMap& Mip = PlatformData->Mips[Level];
+        Mip.BulkData.Lock(LOCK_READ_WRITE);
+        FMemory::Memcpy(Mip.BulkData.Realloc(NumBytes), GetLevel(Level), NumBytes);
+        Mip.BulkData.Unlock();
+    }
+
+    Texture->Filter = Filter;
+    Texture->UpdateResource();
+    return Texture;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TextureDefines.h"
+
+class UTexture2D;
+
+/**
+ * BGRA8 image with its mip chain, level after level in one allocation.
+ * Filled on a worker thread and turned into a texture on the game thread.
+ */
+struct FTextureMipChain
+{
+    /**
+     * Sizes the levels for a base image.
+     * @param Width - Width of level 0.
+     * @param Height - Height of level 0.
+     * @param bWithMips - Also allocate every level down to 1x1.
+     */
+    void Init(int32 Width, int32 Height, bool bWithMips);
+
+    int32 NumLevels() const { return LevelSizes.Num(); }
+    FIntPoint GetLevelSize(int32 Level) const { return LevelSizes[Level]; }
+    FColor* GetLevel(int32 Level) { return Texels.GetData() + LevelOffsets[Level]; }
+    const FColor* GetLevel(int32 Level) const { return Texels.GetData() + LevelOffsets[Level]; }
+
+    /** Fills every level below 0 with a 2x2 box filter of the level above, rows in parallel. */
+    void GenerateMips();
+
+    /** Creates a transient texture holding every level. Game thread only. */
+    UTexture2D* CreateTexture(TextureFilter Filter = TF_Default) const;
+
+private:
+    TArray64<FColor> Texels; // A full mip chain has a third more texels than level 0, which can exceed int32
+    TArray<FIntPoint> LevelSizes;
+    TArray<int64> LevelOffsets;
+};